@@ -69,6 +69,9 @@ public:
   virtual int push(const T &player);
   virtual int push_top(const T &player);
   virtual int rebuild();
+  // replace the champion with the player in place and replay the matches on its path only,
+  // which saves the extra replay of pop() + push() + rebuild() when a run is advanced.
+  int replace_top(const T &player);
 
   virtual OB_INLINE int count() const { return player_cnt_ - cur_free_cnt_; }
   virtual OB_INLINE bool empty() const { return player_cnt_ == cur_free_cnt_; }
@@ -547,6 +550,48 @@ int ObLoserTree<T, CompareFunctor, MAX_PLAYER_CNT>::push_top(const T &player)
   return OB_NOT_SUPPORTED;
 }
 
+template <typename T, typename CompareFunctor, int64_t MAX_PLAYER_CNT>
+int ObLoserTree<T, CompareFunctor, MAX_PLAYER_CNT>::replace_top(const T &player)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LIB_LOG(WARN, "not init", K(ret));
+  } else if (need_rebuild_) {
+    ret = OB_ERR_UNEXPECTED;
+    LIB_LOG(WARN, "new players has been push, please rebuild", K(ret));
+  } else if (empty()) {
+    ret = OB_EMPTY_RESULT;
+    LIB_LOG(WARN, "the tree is already empty", K(ret));
+  } else if (is_single_player()) {
+    players_[0] = player;
+  } else {
+    const int64_t champion = matches_[0].winner_idx_;
+    if (champion < 0 || champion >= player_cnt_) {
+      ret = OB_ERR_UNEXPECTED;
+      LIB_LOG(WARN, "champion is invalid", K(ret), K(matches_[0]));
+    } else {
+      players_[champion] = player;
+      int64_t child = get_leaf(champion);
+      int64_t parent = INVALID_IDX;
+      while (OB_SUCC(ret) && child > 0) {
+        parent = get_parent(child);
+        if (OB_FAIL(get_match_result(matches_[child].winner_idx_,
+                                     matches_[parent].loser_idx_,
+                                     parent))) {
+          LIB_LOG(WARN, "get match result fail", K(ret), K(child), K(parent));
+        } else {
+          child = parent;
+        }
+      }
+      if (OB_SUCC(ret)) {
+        set_unique_champion();
+      }
+    }
+  }
+  return ret;
+}
+
 template <typename T, typename CompareFunctor, int64_t MAX_PLAYER_CNT>
 int ObLoserTree<T, CompareFunctor, MAX_PLAYER_CNT>::pop()
 {
@@ -35,7 +35,7 @@ private:
   int64_t value_;
 };
 
-template <int64_t SLOT_NUM, typename SlotPicker>
+template <int64_t SLOT_NUM, typename SlotPicker, int64_t ITEM_SIZE = 16>
 class ObCounter
 {
 public:
@@ -64,10 +64,14 @@ public:
     return sum;
   }
 private:
+  // slots are ITEM_SIZE bytes apart, so values of slots never share a cache line when
+  // ITEM_SIZE is the cache line size, whatever the alignment of the counter itself.
   struct Item
   {
     int64_t value_;
+    char padding_[ITEM_SIZE - sizeof(int64_t)];
   } __attribute__ ((aligned (16)));
+  static_assert(ITEM_SIZE % 16 == 0, "counter item size must be a multiple of 16");
   Item items_[SLOT_NUM];
 };
 
@@ -96,6 +100,8 @@ static const int64_t OB_COUNTER_MAX_CPU_NUM = 128;
 typedef ObCounter<OB_COUNTER_MAX_THREAD_NUM, ObCounterSlotPickerByThread> ObTCCounter;
 typedef ObCounter<OB_COUNTER_MAX_CPU_NUM, ObCounterSlotPickerByCPU> ObPCCounter;
 typedef ObCounter<OB_COUNTER_MAX_CPU_NUM/4, ObCounterSlotPickerByCPUNonAtomic> ObPCNonAtomicCounter;
+// every slot takes a whole cache line, for counters updated by all cpus at high rate
+typedef ObCounter<OB_COUNTER_MAX_CPU_NUM, ObCounterSlotPickerByCPU, CACHE_ALIGN_SIZE> ObCacheAlignedPCCounter;
 
 } // end namespace common
 } // end namespace oceanbase
@@ -339,6 +339,76 @@ TEST_F(ObLoserTreeTest, unique_champion)
   ASSERT_EQ(ret, OB_SUCCESS);
   ASSERT_FALSE(tree.is_unique_champion());
 }
+
+TEST_F(ObLoserTreeTest, replace_top)
+{
+  int ret = 0;
+  TestMaxComp tc;
+  ObArenaAllocator allocator;
+  ObLoserTree<int64_t, TestMaxComp, 8> tree(tc);
+  const int64_t DATA_CNT = 5;
+  int64_t data[DATA_CNT] = {9, 2, 7, 4, 8};
+  const int64_t *top = nullptr;
+
+  ret = tree.replace_top(data[0]);
+  ASSERT_EQ(ret, OB_NOT_INIT);
+  ret = tree.init(DATA_CNT, allocator);
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ret = tree.replace_top(data[0]);
+  ASSERT_EQ(ret, OB_EMPTY_RESULT);
+
+  for (int64_t i = 0; i < DATA_CNT; ++i) {
+    ret = tree.push(data[i]);
+    ASSERT_EQ(ret, OB_SUCCESS);
+  }
+  // not rebuild
+  ret = tree.replace_top(data[0]);
+  ASSERT_EQ(ret, OB_ERR_UNEXPECTED);
+  ret = tree.rebuild();
+  ASSERT_EQ(ret, OB_SUCCESS);
+
+  // {9, 2, 7, 4, 8} -> {1, 2, 7, 4, 8}
+  ret = tree.replace_top(1);
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ret = tree.top(top);
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ASSERT_EQ(8, *top);
+  ASSERT_EQ(DATA_CNT, tree.count());
+
+  // {1, 2, 7, 4, 8} -> {1, 2, 7, 4, 7}
+  ret = tree.replace_top(7);
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ret = tree.top(top);
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ASSERT_EQ(7, *top);
+  ASSERT_FALSE(tree.is_unique_champion());
+
+  // {1, 2, 7, 4, 7} -> {1, 2, null, 4, null} -> {1, 2, null, 3, null}
+  ret = tree.pop();
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ret = tree.top(top);
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ASSERT_EQ(7, *top);
+  ASSERT_TRUE(tree.is_unique_champion());
+  ret = tree.pop();
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ret = tree.top(top);
+  ASSERT_EQ(ret, OB_SUCCESS);
+  ASSERT_EQ(4, *top);
+  ret = tree.replace_top(3);
+  ASSERT_EQ(ret, OB_SUCCESS);
+
+  int64_t expect[] = {3, 2, 1};
+  for (int64_t i = 0; i < 3; ++i) {
+    ret = tree.top(top);
+    ASSERT_EQ(ret, OB_SUCCESS);
+    ASSERT_EQ(expect[i], *top);
+    ret = tree.pop();
+    ASSERT_EQ(ret, OB_SUCCESS);
+  }
+  ASSERT_TRUE(tree.empty());
+}
+
 int main(int argc, char **argv)
 {
   ::testing::InitGoogleTest(&argc,argv);
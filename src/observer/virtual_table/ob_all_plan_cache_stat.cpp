@@ -115,18 +115,20 @@ int ObAllPlanCacheStat::fill_cells(ObPlanCache &plan_cache)
       break;
     }
     case ACCESS_COUNT: {
-      cells[i].set_int(pc_stat.access_count_);
+      cells[i].set_int(pc_stat.get_access_count());
       break;
     }
     case HIT_COUNT: {
-      cells[i].set_int(pc_stat.hit_count_);
+      cells[i].set_int(pc_stat.get_hit_count());
       break;
     }
     //hit_rate
     case HIT_RATE: {
-      if (pc_stat.access_count_ !=0) {
-        cells[i].set_int(pc_stat.hit_count_*100/pc_stat.access_count_);
-        SERVER_LOG(DEBUG, "rate:", "hit_count", pc_stat.hit_count_, "access_count", pc_stat.access_count_);
+      const int64_t access_count = pc_stat.get_access_count();
+      const int64_t hit_count = pc_stat.get_hit_count();
+      if (access_count != 0) {
+        cells[i].set_int(hit_count*100/access_count);
+        SERVER_LOG(DEBUG, "rate:", "hit_count", hit_count, "access_count", access_count);
       } else {
         cells[i].set_int(0);
       }
@@ -60,6 +60,12 @@ SQL_MONITOR_STATNAME_DEF(SSTABLE_INSERT_ROW_COUNT, sql_monitor_statname::INT, "s
 SQL_MONITOR_STATNAME_DEF(IO_READ_BYTES, sql_monitor_statname::CAPACITY, "total io bytes read from disk", "total io bytes read from storage")
 SQL_MONITOR_STATNAME_DEF(TOTAL_READ_BYTES, sql_monitor_statname::CAPACITY, "total bytes processed by storage", "total bytes processed by storage, including memtable")
 SQL_MONITOR_STATNAME_DEF(TOTAL_READ_ROW_COUNT, sql_monitor_statname::INT, "total rows processed by storage", "total rows processed by storage, including memtable")
+// GI granule time
+SQL_MONITOR_STATNAME_DEF(MAX_GRANULE_TIME, sql_monitor_statname::INT, "max granule time", "max time taken by one granule in GI op")
+SQL_MONITOR_STATNAME_DEF(TOTAL_GRANULE_TIME, sql_monitor_statname::INT, "total granule time", "total time taken by all granules in GI op")
+// SPF subquery cache
+SQL_MONITOR_STATNAME_DEF(SUBQUERY_CACHE_PROBE_COUNT, sql_monitor_statname::INT, "subquery cache probe count", "times of probing subquery result cache in SPF op")
+SQL_MONITOR_STATNAME_DEF(SUBQUERY_CACHE_HIT_COUNT, sql_monitor_statname::INT, "subquery cache hit count", "times of hitting subquery result cache in SPF op")
 
 //end
 SQL_MONITOR_STATNAME_DEF(MONITOR_STATNAME_END, sql_monitor_statname::INVALID, "monitor end", "monitor stat name end")
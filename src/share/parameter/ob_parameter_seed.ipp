@@ -425,6 +425,10 @@ DEF_BOOL(_force_hash_join_spill, OB_TENANT_PARAMETER, "False",
          "force hash join to dump after get all build hash table "
          "Value:  True:turned on  False: turned off",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_STR_WITH_CHECKER(_sql_spill_compress_func, OB_TENANT_PARAMETER, "none",
+                     common::ObConfigCompressFuncChecker,
+                     "compressor used for blocks dumped by sql operators. Values: none, lz4_1.0, zstd_1.0, zstd_1.3.8",
+                     ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_enable_hash_join_hasher, OB_TENANT_PARAMETER, "1", "[1, 7]",
          "which hash function to choose for hash join "
          "1: murmurhash, 2: crc, 4: xxhash",
@@ -1239,10 +1243,18 @@ DEF_INT(open_cursors, OB_TENANT_PARAMETER, "50", "[0,65535]",
 DEF_BOOL(_enable_px_batch_rescan, OB_TENANT_PARAMETER, "True",
          "enable px batch rescan for nlj or subplan filter",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_adaptive_nlj_group_size, OB_TENANT_PARAMETER, "False",
+         "enable batched nested loop join to start every left iteration with a small group "
+         "and double the group size while the left child keeps filling the group buffer",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_INT(_parallel_max_active_sessions, OB_TENANT_PARAMETER, "0", "[0,]",
         "max active parallel sessions allowed for tenant. Range: [0,+∞)",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_px_admission_workarea_limit_percentage, OB_TENANT_PARAMETER, "0", "[0,100]",
+        "new parallel queries wait for running ones to finish when sql work area memory hold "
+        "exceeds this percentage of the max work area size, 0 means no limit. Range: [0,100]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 DEF_BOOL(enable_tcp_keepalive, OB_CLUSTER_PARAMETER, "true",
          "enable TCP keepalive for the TCP connection of sql protocol. Take effect for "
@@ -1555,6 +1567,16 @@ DEF_BOOL(_xsolapi_generate_with_clause, OB_TENANT_PARAMETER, "True",
 DEF_BOOL(_optimizer_group_by_placement, OB_TENANT_PARAMETER, "True",
         "enable group by placement transform rule",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_DBL(_optimizer_cardinality_feedback_ratio, OB_TENANT_PARAMETER, "0", "[0,)",
+        "when the actual row count of an operator differs from its estimation by more than "
+        "this ratio at the first execution, the plan is expired and the sql uses dynamic sampling "
+        "at next hard parse. values not greater than 1 disable cardinality feedback. Range: [0,+∞)",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_optimizer_join_order_dp_limit, OB_TENANT_PARAMETER, "0", "[0,64]",
+        "max number of tables enumerated together by dynamic programming in one round of join "
+        "order generation, more tables are joined step by step greedily. 0 means no limit. "
+        "Range: [0,64]",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_TIME(_wait_interval_after_truncate, OB_CLUSTER_PARAMETER, "30s", "[0s,)",
         "time interval for waiting other servers to refresh schema after truncate",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -1567,6 +1589,9 @@ DEF_BOOL(_enable_in_range_optimization, OB_TENANT_PARAMETER, "True",
 DEF_BOOL(_force_explict_500_malloc, OB_CLUSTER_PARAMETER, "False",
          "Force 500 memory for explicit allocation",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_skip_index, OB_TENANT_PARAMETER, "False",
+        "specifies whether to build per micro block min/max/null count skip index during major compaction",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_CAP(range_optimizer_max_mem_size, OB_TENANT_PARAMETER, "128M", "[16M,1G]",
         "to limit the memory consumption for the query range optimizer. Range: [16M,1G]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -3735,6 +3735,7 @@ int ObStaticEngineCG::generate_spec(ObLogGroupBy &op, ObHashGroupBySpec &spec,
     spec.set_est_group_cnt(op.get_distinct_card());
     OZ(set_3stage_info(op, spec));
     spec.by_pass_enabled_ = op.is_adaptive_aggregate();
+    spec.use_radix_partition_ = op.use_radix_partition();
     if (OB_FAIL(ret)) {
     } else if (OB_FAIL(generate_dist_aggr_distinct_columns(op, spec))) {
       LOG_WARN("failed to generate distinct aggregate function duplicate columns", K(ret));
@@ -4943,6 +4944,56 @@ int ObStaticEngineCG::add_update_set(ObSubPlanFilterSpec &spec)
   return ret;
 }
 
+int ObStaticEngineCG::check_subquery_deterministic(const ObDMLStmt *stmt, bool &is_deterministic)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObRawExpr *, 16> exprs;
+  ObSEArray<ObSelectStmt *, 4> child_stmts;
+  is_deterministic = true;
+  if (OB_ISNULL(stmt)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null stmt", K(ret));
+  } else if (stmt->has_sequence() || stmt->is_contains_assignment()) {
+    is_deterministic = false;
+  } else if (OB_FAIL(stmt->get_relation_exprs(exprs))) {
+    LOG_WARN("failed to get relation exprs", K(ret));
+  } else if (OB_FAIL(stmt->get_child_stmts(child_stmts))) {
+    LOG_WARN("failed to get child stmts", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && is_deterministic && i < exprs.count(); ++i) {
+    const ObRawExpr *expr = exprs.at(i);
+    if (OB_ISNULL(expr)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("get unexpected null expr", K(ret));
+    } else if (expr->has_flag(CNT_RAND_FUNC)
+               || expr->has_flag(CNT_STATE_FUNC)
+               || expr->has_flag(CNT_USER_VARIABLE)
+               || expr->has_flag(CNT_ASSIGN_EXPR)
+               || expr->has_flag(CNT_SEQ_EXPR)
+               || expr->has_flag(CNT_SO_UDF)
+               || expr->has_flag(CNT_VOLATILE_CONST)) {
+      // rand(), uuid(), sysdate(), @var, nextval and udf may differ between
+      // two executions with the same exec params
+      is_deterministic = false;
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && is_deterministic && i < stmt->get_table_size(); ++i) {
+    const TableItem *table = stmt->get_table_item(i);
+    if (OB_ISNULL(table)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("get unexpected null table item", K(ret));
+    } else if (table->is_temp_table() && OB_FAIL(child_stmts.push_back(table->ref_query_))) {
+      LOG_WARN("failed to push back temp table query", K(ret));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && is_deterministic && i < child_stmts.count(); ++i) {
+    if (OB_FAIL(SMART_CALL(check_subquery_deterministic(child_stmts.at(i), is_deterministic)))) {
+      LOG_WARN("failed to check child stmt deterministic", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObStaticEngineCG::generate_spec(
     ObLogSubPlanFilter &op, ObSubPlanFilterSpec &spec, const bool)
 {
@@ -5005,6 +5056,7 @@ int ObStaticEngineCG::generate_spec(
        for (int64_t child_idx = 1; OB_SUCC(ret) && child_idx < spec.get_child_cnt(); ++child_idx) {
          SubPlanInfo *sp_info = nullptr;
          ObLogicalOperator *curr_child = nullptr;
+         bool is_deterministic = false;
         if (OB_ISNULL(curr_child = op.get_child(child_idx))
               || OB_ISNULL(curr_child->get_stmt())) {
             ret = OB_ERR_UNEXPECTED;
@@ -5014,6 +5066,10 @@ int ObStaticEngineCG::generate_spec(
         } else if (OB_ISNULL(sp_info) || OB_ISNULL(sp_info->init_expr_)) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("sp info is invalid", K(ret), K(sp_info));
+        } else if (OB_FAIL(check_subquery_deterministic(curr_child->get_stmt(), is_deterministic))) {
+          LOG_WARN("failed to check subquery deterministic", K(ret), K(child_idx));
+        } else if (is_deterministic && OB_FAIL(spec.deterministic_idxs_.add_member(child_idx))) {
+          LOG_WARN("failed to add deterministic subquery idx", K(ret), K(child_idx));
         } else {
           cache_vec.reset();
           if (OB_FAIL(cache_vec.init(sp_info->init_expr_->get_param_count()))) {
@@ -395,6 +395,8 @@ private:
   int generate_spec(ObLogOptimizerStatsGathering &op, ObOptimizerStatsGatheringSpec &spec, const bool in_root_job);
 private:
   int add_update_set(ObSubPlanFilterSpec &spec);
+  // 子查询的结果只由 exec param 决定时, 才能用 hashmap 缓存结果
+  static int check_subquery_deterministic(const ObDMLStmt *stmt, bool &is_deterministic);
   int generate_basic_transmit_spec(
       ObLogExchange &op, ObPxTransmitSpec &spec, const bool in_root_job);
   int generate_basic_receive_spec(
@@ -32,7 +32,7 @@ OB_SERIALIZE_MEMBER(ObGroupByDupColumnPair, org_expr, dup_expr);
 OB_SERIALIZE_MEMBER((ObHashGroupBySpec, ObGroupBySpec),
   group_exprs_,cmp_funcs_, est_group_cnt_,
   org_dup_cols_, new_dup_cols_, dist_col_group_idxs_,
-  distinct_exprs_);
+  distinct_exprs_, use_radix_partition_);
 
 DEF_TO_STRING(ObHashGroupBySpec)
 {
@@ -42,7 +42,7 @@ DEF_TO_STRING(ObHashGroupBySpec)
   J_COLON();
   pos += ObGroupBySpec::to_string(buf + pos, buf_len - pos);
   J_COMMA();
-  J_KV(K_(group_exprs));
+  J_KV(K_(group_exprs), K_(use_radix_partition));
   J_OBJ_END();
   return pos;
 }
@@ -156,6 +156,7 @@ void ObHashGroupByOp::reset()
   by_pass_group_batch_ = nullptr;
   by_pass_batch_size_ = 0;
   force_by_pass_ = false;
+  radix_partitioning_ = false;
   if (nullptr != last_child_row_) {
     last_child_row_->reset();
   }
@@ -230,6 +231,13 @@ int ObHashGroupByOp::inner_open()
     } else {
       enable_dump_ = (!(aggr_processor_.has_distinct() || aggr_processor_.has_order_by())
                      && GCONF.is_sql_operator_dump_enabled());
+      radix_part_cnt_ = (MY_SPEC.use_radix_partition_
+                         && enable_dump_
+                         && is_vectorized()
+                         && !MY_SPEC.by_pass_enabled_
+                         && ObThreeStageAggrStage::NONE_STAGE == MY_SPEC.aggr_stage_
+                         && est_group_cnt >= RADIX_PARTITION_MIN_GROUP_CNT)
+                        ? calc_radix_part_cnt(est_group_cnt) : 0;
       group_store_.set_dir_id(sql_mem_processor_.get_dir_id());
       group_store_.set_callback(&sql_mem_processor_);
       group_store_.set_allocator(mem_context_->get_malloc_allocator());
@@ -245,7 +253,7 @@ int ObHashGroupByOp::inner_open()
         LOG_WARN("invalid tenant config", K(ret));
       }
       LOG_TRACE("trace init hash table", K(init_size), K(MY_SPEC.est_group_cnt_), K(est_group_cnt),
-        K(est_hash_mem_size), K(estimate_mem_size),
+        K(est_hash_mem_size), K(estimate_mem_size), K(radix_part_cnt_),
         K(profile_.get_expect_size()),
         K(profile_.get_cache_size()),
         K(sql_mem_processor_.get_mem_bound()));
@@ -1326,8 +1334,12 @@ int ObHashGroupByOp::setup_dump_env(const int64_t part_id, const int64_t input_r
     LOG_WARN("invalid argument", K(ret), K(input_rows), KP(parts));
   } else {
     int64_t pre_part_cnt = 0;
-    part_cnt = pre_part_cnt = detect_part_cnt(input_rows);
-    adjust_part_cnt(part_cnt);
+    if (radix_partitioning_) {
+      part_cnt = pre_part_cnt = radix_part_cnt_;
+    } else {
+      part_cnt = pre_part_cnt = detect_part_cnt(input_rows);
+      adjust_part_cnt(part_cnt);
+    }
     MEMSET(parts, 0, sizeof(parts[0]) * part_cnt);
     part_shift_ += min(__builtin_ctz(part_cnt), 8);
     if (OB_SUCC(ret) && NULL == bloom_filter) {
@@ -1341,7 +1353,7 @@ int ObHashGroupByOp::setup_dump_env(const int64_t part_id, const int64_t input_r
         ret = OB_ALLOCATE_MEMORY_FAILED;
         LOG_WARN("allocate memory failed", K(ret));
       } else if (FALSE_IT(bloom_filter = new(mem)ObGbyBloomFilter(mod_alloc))) {
-      } else if (OB_FAIL(bloom_filter->init(local_group_rows_.size()))) {
+      } else if (OB_FAIL(bloom_filter->init(std::max(local_group_rows_.size(), (int64_t)1)))) {
         LOG_WARN("bloom filter init failed", K(ret));
       } else {
         auto cb_func = [&](ObGroupRowItem &item) {
@@ -1366,7 +1378,9 @@ int ObHashGroupByOp::setup_dump_env(const int64_t part_id, const int64_t input_r
         parts[i]->part_id_ = part_id + 1;
         parts[i]->part_shift_ = part_shift_;
         const int64_t extra_size = sizeof(uint64_t); // for hash value
-        if (OB_FAIL(parts[i]->datum_store_.init(1 /* memory limit, dump immediately */,
+        // radix partitions are kept in memory until memory bound is reached
+        const int64_t mem_limit = radix_partitioning_ ? 0 : 1 /* dump immediately */;
+        if (OB_FAIL(parts[i]->datum_store_.init(mem_limit,
             ctx_.get_my_session()->get_effective_tenant_id(),
             ObCtxIds::WORK_AREA,
             ObModIds::OB_HASH_NODE_GROUP_ROWS,
@@ -1404,9 +1418,11 @@ int ObHashGroupByOp::cleanup_dump_env(const bool dump_success, const int64_t par
     for (int64_t i = 0; OB_SUCC(ret) && i < part_cnt; i++) {
       DatumStoreLinkPartition *&p = parts[i];
       if (p->datum_store_.get_row_cnt() > 0) {
-        if (OB_FAIL(p->datum_store_.dump(false, true))) {
+        // in-memory radix partition is not dumped unless part of it has been dumped
+        const bool need_dump = !radix_partitioning_ || p->datum_store_.has_dumped();
+        if (need_dump && OB_FAIL(p->datum_store_.dump(false, true))) {
           LOG_WARN("failed to dump partition", K(ret), K(i));
-        } else if (OB_FAIL(p->datum_store_.finish_add_row(true /* do dump */))) {
+        } else if (OB_FAIL(p->datum_store_.finish_add_row(need_dump))) {
           LOG_WARN("do dump failed", K(ret));
         } else {
           part_rows[i] = p->datum_store_.get_row_cnt();
@@ -1423,7 +1439,7 @@ int ObHashGroupByOp::cleanup_dump_env(const bool dump_success, const int64_t par
         part_file_size[i] = 0;
       }
     }
-    LOG_TRACE("hash group by dumped", K(part_id),
+    LOG_TRACE("hash group by dumped", K(part_id), K(radix_partitioning_),
         K(local_group_rows_.size()),
         K(get_mem_used_size()),
         K(get_aggr_used_size()),
@@ -1458,6 +1474,47 @@ int ObHashGroupByOp::cleanup_dump_env(const bool dump_success, const int64_t par
   return ret;
 }
 
+int64_t ObHashGroupByOp::calc_radix_part_cnt(const int64_t est_group_cnt) const
+{
+  // groups of one partition are expected to be aggregated in L2 cache
+  const int64_t groups_per_part = std::max(INIT_L2_CACHE_SIZE / RADIX_PARTITION_GROUP_SIZE,
+                                           (int64_t)1);
+  int64_t part_cnt = next_pow2((est_group_cnt + groups_per_part - 1) / groups_per_part);
+  part_cnt = std::max(part_cnt, (int64_t)MIN_PARTITION_CNT);
+  part_cnt = std::min(part_cnt, (int64_t)MAX_PARTITION_CNT);
+  return part_cnt;
+}
+
+int ObHashGroupByOp::spill_radix_parts(DatumStoreLinkPartition **parts, const int64_t part_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (get_mem_used_size() <= get_mem_bound_size()) {
+    // keep radix partitions in memory
+  } else if (OB_ISNULL(parts)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(parts));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < part_cnt; i++) {
+      if (OB_ISNULL(parts[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("partition is null", K(ret), K(i));
+      } else if (parts[i]->datum_store_.get_row_cnt_in_memory() > 0
+                 && OB_FAIL(parts[i]->datum_store_.dump(false, true))) {
+        LOG_WARN("failed to dump radix partition", K(ret), K(i));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(sql_mem_processor_.update_used_mem_size(get_mem_used_size()))) {
+      LOG_WARN("failed to update used memory size", K(ret));
+    } else {
+      sql_mem_processor_.set_number_pass(1);
+      LOG_TRACE("trace spill radix partitions", K(part_cnt), K(get_mem_used_size()),
+                K(get_mem_bound_size()));
+    }
+  }
+  return ret;
+}
+
 void ObHashGroupByOp::destroy_all_parts()
 {
   if (NULL != mem_context_) {
@@ -1620,6 +1677,13 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
   int64_t loop_cnt = 0;
   int64_t last_batch_size = 0;
 
+  // radix partition mode: scatter all input rows of the first round to partitions
+  radix_partitioning_ = 0 < radix_part_cnt_ && NULL == cur_part && !group_rows_arr_.is_valid_;
+  if (OB_SUCC(ret) && radix_partitioning_
+      && OB_FAIL(setup_dump_env(part_id, input_rows, parts, part_cnt, bloom_filter))) {
+    LOG_WARN("setup radix partition environment failed", K(ret));
+  }
+
   while (OB_SUCC(ret)) {
     bypass_ctrl_.gby_process_state(last_batch_size,
                                    local_group_rows_.size(),
@@ -1659,7 +1723,7 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
                                              loop_cnt, *child_brs, part_cnt, parts, est_part_cnt,
                                              bloom_filter))) {
           LOG_WARN("fail to group child batch rows", K(ret));
-        } else if (no_non_distinct_aggr_) {
+        } else if (no_non_distinct_aggr_ || radix_partitioning_) {
         } else if (OB_FAIL(aggr_processor_.eval_aggr_param_batch(*child_brs))) {
           LOG_WARN("fail to eval aggr param batch", K(ret), K(*child_brs));
         }
@@ -1684,6 +1748,9 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
           }
         }
       }
+      if (OB_SUCC(ret) && radix_partitioning_ && OB_FAIL(spill_radix_parts(parts, part_cnt))) {
+        LOG_WARN("failed to spill radix partitions", K(ret));
+      }
       gri_cnt_per_batch_ = 0;
       if (child_brs->end_) {
         break;
@@ -1705,6 +1772,7 @@ int ObHashGroupByOp::load_data_batch(int64_t max_row_cnt)
     LOG_WARN("cleanup dump environment failed", K(tmp_ret), K(ret));
     ret = OB_SUCCESS == ret ? tmp_ret : ret;
   }
+  radix_partitioning_ = false;
 
   if (NULL != mem_context_ && NULL != cur_part) {
     cur_part->~DatumStoreLinkPartition();
@@ -1742,7 +1810,10 @@ int ObHashGroupByOp::switch_part(DatumStoreLinkPartition *&cur_part,
       input_rows = cur_part->datum_store_.get_row_cnt();
       part_id = cur_part->part_id_;
       part_shift = part_shift_ = cur_part->part_shift_;
-      input_size = cur_part->datum_store_.get_file_size();
+      // in-memory radix partition has no file, size the work area by its rows in memory
+      input_size = cur_part->datum_store_.has_dumped()
+                   ? cur_part->datum_store_.get_file_size()
+                   : cur_part->datum_store_.get_mem_used();
     }
   } else {
     if (is_init_distinct_data_ && !use_distinct_data_) {
@@ -2279,11 +2350,12 @@ int ObHashGroupByOp::group_child_batch_rows(const ObChunkDatumStore::StoredRow *
         const_cast<ObGroupRowItem *>(exist_curr_gr_item)->group_row_count_in_batch_++;
         LOG_DEBUG("exist item", K(gri_cnt_per_batch_), K(*exist_curr_gr_item),
                                 K(i), K(agged_row_cnt_));
-      } else if (!enable_dump_
-              || local_group_rows_.size() < MIN_INMEM_GROUPS
-              || process_check_dump
-              || (NULL == bloom_filter
-                  && !need_start_dump(input_rows, est_part_cnt, force_check_dump))) {
+      } else if (!radix_partitioning_
+                 && (!enable_dump_
+                     || local_group_rows_.size() < MIN_INMEM_GROUPS
+                     || process_check_dump
+                     || (NULL == bloom_filter
+                         && !need_start_dump(input_rows, est_part_cnt, force_check_dump)))) {
         // add new local group
         if (!batch_hash_calculated) {
           calc_groupby_exprs_hash_batch(dup_groupby_exprs_, child_brs);
@@ -46,7 +46,8 @@ public:
       org_dup_cols_(alloc),
       new_dup_cols_(alloc),
       dist_col_group_idxs_(alloc),
-      distinct_exprs_(alloc)
+      distinct_exprs_(alloc),
+      use_radix_partition_(false)
     {
     }
 
@@ -69,6 +70,8 @@ public:
   common::ObFixedArray<ObExpr*, common::ObIAllocator> new_dup_cols_;
   common::ObFixedArray<int64_t, common::ObIAllocator> dist_col_group_idxs_;
   ExprFixedArray distinct_exprs_; // the distinct arguments of aggregate function
+  // too many groups to fit in cache, scatter rows to radix partitions before aggregation
+  bool use_radix_partition_;
 };
 
 //Used for calc hash for columns
@@ -217,6 +220,10 @@ public:
   static constexpr const double MAX_PART_MEM_RATIO = 0.5;
   static constexpr const double EXTRA_MEM_RATIO = 0.25;
   static const int64_t FIX_SIZE_PER_PART = sizeof(DatumStoreLinkPartition) + ObChunkRowStore::BLOCK_SIZE;
+  // min estimated groups per dop to aggregate by radix partitions
+  static const int64_t RADIX_PARTITION_MIN_GROUP_CNT = 1 << 20;
+  // approximate memory of one group in hash table: bucket + group row item + group row
+  static const int64_t RADIX_PARTITION_GROUP_SIZE = 128;
 
 
 public:
@@ -268,7 +275,9 @@ public:
       by_pass_nth_group_(0),
       last_child_row_(nullptr),
       by_pass_child_brs_(nullptr),
-      force_by_pass_(false)
+      force_by_pass_(false),
+      radix_partitioning_(false),
+      radix_part_cnt_(0)
   {
   }
   void reset();
@@ -355,6 +364,8 @@ public:
                      DatumStoreLinkPartition **parts, int64_t &part_cnt,
                      ObGbyBloomFilter *&bloom_filter);
 
+  int64_t calc_radix_part_cnt(const int64_t est_group_cnt) const;
+  int spill_radix_parts(DatumStoreLinkPartition **parts, const int64_t part_cnt);
   int cleanup_dump_env(const bool dump_success, const int64_t part_id,
                        DatumStoreLinkPartition **parts, int64_t &part_cnt,
                        ObGbyBloomFilter *&bloom_filter);
@@ -599,6 +610,10 @@ private:
   const ObBatchRows *by_pass_child_brs_;
   ObBatchResultHolder by_pass_brs_holder_;
   bool force_by_pass_;
+  // first round of radix partition mode: all rows are scattered to in-memory partitions,
+  // each partition is aggregated in a cache-sized hash table later.
+  bool radix_partitioning_;
+  int64_t radix_part_cnt_;
 };
 
 } // end namespace sql
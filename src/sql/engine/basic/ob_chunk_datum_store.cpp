@@ -19,6 +19,8 @@
 #include "lib/container/ob_se_array_iterator.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "share/config/ob_server_config.h"
+#include "lib/compress/ob_compressor_pool.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -291,6 +293,65 @@ int ObChunkDatumStore::BlockBufferWrap::append_row(
   return ret;
 }
 
+int ObChunkDatumStore::BlockBufferWrap::append_batch(
+  const common::ObIArray<ObExpr*> &exprs, ObEvalCtx &ctx,
+  const uint16_t selector[], const int64_t size, int64_t &appended)
+{
+  int ret = OB_SUCCESS;
+  OB_ASSERT(is_inited());
+  appended = 0;
+  const int64_t col_cnt = exprs.count();
+  const int64_t base_row_size = sizeof(StoredRow) + sizeof(ObDatum) * col_cnt;
+  const int64_t max_size = remain();
+  int64_t data_size = 0;
+  // place row headers of the rows fit in buffer
+  for (int64_t i = 0; i < size; i++) {
+    int64_t row_size = base_row_size;
+    for (int64_t col_idx = 0; col_idx < col_cnt; col_idx++) {
+      const ObExpr *e = exprs.at(col_idx);
+      const ObDatum &src = e->locate_batch_datums(ctx)[e->is_batch_result() ? selector[i] : 0];
+      row_size += src.is_null() ? 0 : src.len_;
+    }
+    if (data_size + row_size > max_size) {
+      break;
+    } else {
+      StoredRow *sr = reinterpret_cast<StoredRow *>(head() + data_size);
+      sr->cnt_ = static_cast<uint32_t>(col_cnt);
+      sr->row_size_ = static_cast<int32_t>(row_size);
+      data_size += row_size;
+      appended += 1;
+    }
+  }
+  // copy datums column by column, datum offset of column is the end of previous column
+  for (int64_t col_idx = 0; col_idx < col_cnt; col_idx++) {
+    const ObExpr *e = exprs.at(col_idx);
+    const ObDatum *datums = e->locate_batch_datums(ctx);
+    const bool is_batch = e->is_batch_result();
+    char *row_buf = head();
+    for (int64_t i = 0; i < appended; i++) {
+      StoredRow *sr = reinterpret_cast<StoredRow *>(row_buf);
+      const ObDatum &src = datums[is_batch ? selector[i] : 0];
+      ObDatum &dst = sr->cells()[col_idx];
+      int64_t pos = base_row_size;
+      if (col_idx > 0) {
+        const ObDatum &prev = sr->cells()[col_idx - 1];
+        pos = reinterpret_cast<int64_t>(prev.ptr_) + (prev.is_null() ? 0 : prev.len_);
+      }
+      dst.pack_ = src.pack_;
+      dst.ptr_ = reinterpret_cast<const char *>(pos); // unswizzled offset
+      if (!src.is_null()) {
+        MEMCPY(row_buf + pos, src.ptr_, src.len_);
+      }
+      row_buf += sr->row_size_;
+    }
+  }
+  if (appended > 0) {
+    fast_advance(data_size);
+    rows_ += static_cast<uint32_t>(appended);
+  }
+  return ret;
+}
+
 int ObChunkDatumStore::Block::append_row(
   const common::ObIArray<ObExpr*> &exprs, ObEvalCtx *ctx,
   BlockBuffer *buf, int64_t row_extend_size, StoredRow **stored_row, const bool unswizzling)
@@ -488,7 +549,8 @@ ObChunkDatumStore::ObChunkDatumStore(common::ObIAllocator *alloc /* = NULL */)
     mem_hold_(0), mem_used_(0), max_hold_mem_(0),
     allocator_(NULL == alloc ? &inner_allocator_ : alloc),
     row_extend_size_(0), callback_(nullptr), batch_ctx_(NULL),
-    tmp_dump_blk_(nullptr)
+    tmp_dump_blk_(nullptr), compressor_(nullptr), compress_buf_(nullptr),
+    compress_buf_size_(0)
 {
   io_.fd_ = -1;
   io_.dir_id_ = -1;
@@ -536,6 +598,7 @@ void ObChunkDatumStore::reset()
   }
   file_size_ = 0;
   n_block_in_file_ = 0;
+  compressor_ = nullptr;
 
   while (!blocks_.is_empty()) {
     Block *item = blocks_.remove_first();
@@ -747,9 +810,16 @@ inline int ObChunkDatumStore::dump_one_block(BlockBuffer *item)
   if (item->cur_pos_ <= 0) {
     LOG_WARN("unexpected: dump zero", K(item), K(item->cur_pos_));
   }
+  bool compressed = false;
   item->block->magic_ = Block::MAGIC;
   if (OB_FAIL(item->get_block()->unswizzling())) {
     LOG_WARN("convert block to copyable failed", K(ret));
+  } else if (!is_file_open() && OB_FAIL(init_compressor())) {
+    LOG_WARN("failed to init compressor", K(ret));
+  } else if (NULL != compressor_ && OB_FAIL(dump_compressed_block(item, compressed))) {
+    LOG_WARN("failed to dump compressed block", K(ret));
+  } else if (compressed) {
+    // compressed block is written
   } else if (item->capacity() < min_block_size) {
     if (OB_ISNULL(tmp_dump_blk_)) {
       if (OB_FAIL(alloc_block_buffer(tmp_dump_blk_, default_block_size_, false))) {
@@ -783,6 +853,82 @@ inline int ObChunkDatumStore::dump_one_block(BlockBuffer *item)
   return ret;
 }
 
+int ObChunkDatumStore::init_compressor()
+{
+  int ret = OB_SUCCESS;
+  ObCompressorType type = NONE_COMPRESSOR;
+  compressor_ = nullptr;
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id_));
+  if (!tenant_config.is_valid()) {
+    // no compression
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor_type(
+              tenant_config->_sql_spill_compress_func, type))) {
+    LOG_WARN("get compressor type failed", K(ret));
+  } else if (NONE_COMPRESSOR == type) {
+  } else if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(type, compressor_))) {
+    LOG_WARN("get compressor failed", K(ret), K(type));
+  }
+  return ret;
+}
+
+// Compress payload of the block and write to file. %dumped is set to false if the compressed
+// block is not smaller than the original one, the caller should write the original block then.
+int ObChunkDatumStore::dump_compressed_block(BlockBuffer *item, bool &dumped)
+{
+  int ret = OB_SUCCESS;
+  dumped = false;
+  const int64_t data_size = item->data_size() - BlockBuffer::HEAD_SIZE;
+  const int64_t head_size = BlockBuffer::HEAD_SIZE + sizeof(int64_t);
+  int64_t max_overflow_size = 0;
+  int64_t compressed_size = 0;
+  if (OB_ISNULL(compressor_) || data_size <= 0) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected compressor or block", K(ret), KP(compressor_), K(data_size));
+  } else if (OB_FAIL(compressor_->get_max_overflow_size(data_size, max_overflow_size))) {
+    LOG_WARN("get max overflow size failed", K(ret), K(data_size));
+  } else {
+    const int64_t buf_size = head_size + data_size + max_overflow_size;
+    if (buf_size > compress_buf_size_) {
+      free_compress_buf();
+      if (OB_ISNULL(compress_buf_ = static_cast<char *>(alloc_blk_mem(buf_size, false)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("alloc compress buffer failed", K(ret), K(buf_size));
+      } else {
+        compress_buf_size_ = buf_size;
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(compressor_->compress(item->get_block()->payload_, data_size,
+                                           compress_buf_ + head_size,
+                                           compress_buf_size_ - head_size, compressed_size))) {
+    LOG_WARN("compress block failed", K(ret), K(data_size));
+  } else if (head_size + compressed_size >= item->capacity()) {
+    // not compressible, dump original block
+  } else {
+    Block *blk = reinterpret_cast<Block *>(compress_buf_);
+    blk->magic_ = Block::COMPRESSED_MAGIC;
+    blk->blk_size_ = static_cast<uint32_t>(head_size + compressed_size);
+    blk->rows_ = item->get_block()->rows_;
+    *reinterpret_cast<int64_t *>(blk->payload_) = data_size;
+    if (OB_FAIL(write_file(compress_buf_, blk->blk_size_))) {
+      LOG_WARN("write compressed block to file failed", K(ret));
+    } else {
+      dumped = true;
+    }
+  }
+  return ret;
+}
+
+void ObChunkDatumStore::free_compress_buf()
+{
+  if (NULL != compress_buf_) {
+    free_blk_mem(compress_buf_, compress_buf_size_);
+    compress_buf_ = nullptr;
+    compress_buf_size_ = 0;
+  }
+}
+
 // only clean memory data
 int ObChunkDatumStore::clean_memory_data(bool reuse)
 {
@@ -2353,6 +2499,7 @@ void ObChunkDatumStore::free_tmp_dump_blk()
     free_block(tmp_dump_blk_);
     tmp_dump_blk_ = nullptr;
   }
+  free_compress_buf();
 }
 
 
@@ -2487,15 +2634,18 @@ int ObChunkDatumStore::Iterator::read_next_blk()
       LOG_WARN("aio wait failed", K(ret));
     }
   }
-  if (OB_SUCC(ret) && !aio_blk_->magic_check()) {
+  if (OB_SUCC(ret) && !aio_blk_->magic_check() && !aio_blk_->is_compressed()) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("read corrupt data", K(ret), K(aio_blk_->magic_),
              K(store_->file_size_), K(cur_iter_pos_));
   }
   if (OB_SUCC(ret)) {
-    // data block is larger than min block
     const int64_t loaded_len = aio_blk_buf_->capacity();
-    if (aio_blk_->blk_size_ > loaded_len) {
+    if (aio_blk_->is_compressed() && aio_blk_->blk_size_ < loaded_len) {
+      // compressed block is smaller than min block, next block starts within the loaded data
+      cur_iter_pos_ -= loaded_len - aio_blk_->blk_size_;
+    } else if (aio_blk_->blk_size_ > loaded_len) {
+      // data block is larger than min block
       Block *blk= NULL;
       if (OB_FAIL(alloc_block(blk, aio_blk_->blk_size_ + sizeof(BlockBuffer)))) {
         LOG_WARN("alloc block failed", K(ret), K(aio_blk_->blk_size_));
@@ -2515,6 +2665,10 @@ int ObChunkDatumStore::Iterator::read_next_blk()
     }
   }
 
+  if (OB_SUCC(ret) && aio_blk_->is_compressed() && OB_FAIL(decompress_aio_blk())) {
+    LOG_WARN("decompress block failed", K(ret));
+  }
+
   if (OB_SUCC(ret)) {
     // move aio block to read block
     if (NULL != read_blk_) {
@@ -2553,6 +2707,42 @@ int ObChunkDatumStore::Iterator::prefetch_next_blk()
   return ret;
 }
 
+int ObChunkDatumStore::Iterator::decompress_aio_blk()
+{
+  int ret = OB_SUCCESS;
+  Block *blk = NULL;
+  const int64_t head_size = BlockBuffer::HEAD_SIZE + sizeof(int64_t);
+  const int64_t data_size = *reinterpret_cast<int64_t *>(aio_blk_->payload_);
+  int64_t decompressed_size = 0;
+  if (OB_ISNULL(store_->compressor_)
+      || OB_UNLIKELY(data_size <= 0 || aio_blk_->blk_size_ <= head_size)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected compressed block", K(ret), KP(store_->compressor_), K(data_size),
+             K(aio_blk_->blk_size_));
+  } else if (OB_FAIL(alloc_block(blk, data_size + BlockBuffer::HEAD_SIZE + sizeof(BlockBuffer)))) {
+    LOG_WARN("alloc block failed", K(ret), K(data_size));
+  } else if (OB_FAIL(store_->compressor_->decompress(
+              reinterpret_cast<char *>(aio_blk_) + head_size, aio_blk_->blk_size_ - head_size,
+              blk->payload_, blk->get_buffer()->capacity() - BlockBuffer::HEAD_SIZE,
+              decompressed_size))) {
+    LOG_WARN("decompress failed", K(ret), K(data_size), K(aio_blk_->blk_size_));
+  } else if (OB_UNLIKELY(decompressed_size != data_size)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("decompressed size mismatch", K(ret), K(data_size), K(decompressed_size));
+  } else {
+    blk->magic_ = Block::MAGIC;
+    blk->rows_ = aio_blk_->rows_;
+    free_block(aio_blk_, aio_blk_buf_->mem_size());
+    aio_blk_ = blk;
+    aio_blk_buf_ = blk->get_buffer();
+    blk = NULL;
+  }
+  if (NULL != blk) {
+    free_block(blk, blk->get_buffer()->mem_size(), true);
+  }
+  return ret;
+}
+
 int ObChunkDatumStore::Iterator::alloc_block(Block *&blk, const int64_t size)
 {
   int ret = OB_SUCCESS;
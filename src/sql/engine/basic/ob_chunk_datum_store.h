@@ -28,6 +28,10 @@
 
 namespace oceanbase
 {
+namespace common
+{
+class ObCompressor;
+}
 namespace sql
 {
 
@@ -389,6 +393,9 @@ public:
   struct Block
   {
     static const int64_t MAGIC = 0xbc054e02d8536315;
+    // compressed block in file:
+    // | Block (blk_size_ is file size) | payload data size | compressed payload |
+    static const int64_t COMPRESSED_MAGIC = 0xbc054e02d8536316;
     static const int32_t ROW_HEAD_SIZE = sizeof(StoredRow);
     Block() : magic_(0), blk_size_(0), rows_(0){}
 
@@ -459,6 +466,7 @@ public:
     int unswizzling();
     int swizzling(int64_t *col_cnt);
     inline bool magic_check() { return MAGIC == magic_; }
+    inline bool is_compressed() const { return COMPRESSED_MAGIC == magic_; }
     int get_store_row(int64_t &cur_pos, const StoredRow *&sr);
     inline Block* get_next() const { return next_; }
     inline bool is_empty() { return get_buffer()->is_empty(); }
@@ -598,6 +606,10 @@ public:
 
     int append_row(const common::ObIArray<ObExpr*> &exprs,
                    ObEvalCtx *ctx, int64_t row_extend_size);
+    // Append rows of vectorized batch in %selector order, datums are copied column by column.
+    // Stop at the first row which can not fit in buffer, %appended is the rows appended.
+    int append_batch(const common::ObIArray<ObExpr*> &exprs, ObEvalCtx &ctx,
+                     const uint16_t selector[], const int64_t size, int64_t &appended);
     void reset() { rows_ = 0; BlockBuffer::reset(); }
 
   public:
@@ -771,6 +783,7 @@ public:
     int read_next_blk();
     int aio_read(char *buf, const int64_t size);
     int aio_wait();
+    int decompress_aio_blk();
     int alloc_block(Block *&blk, const int64_t size);
     void free_block(Block *blk, const int64_t size, bool force_free = false);
     void try_free_cached_blocks();
@@ -1001,6 +1014,9 @@ public:
   inline int64_t get_file_fd() const { return io_.fd_; }
   inline int64_t get_file_dir_id() const { return io_.dir_id_; }
   inline int64_t get_file_size() const { return file_size_; }
+  inline const common::ObCompressor *get_compressor() const { return compressor_; }
+  // overwrite the compressor picked from tenant config, blocks dumped later use it
+  void set_compressor(common::ObCompressor *compressor) { compressor_ = compressor; }
   inline int64_t min_blk_size(const int64_t row_store_size)
   {
     int64_t size = std::max(default_block_size_, row_store_size);
@@ -1081,6 +1097,9 @@ private:
       mem_used_ += used;
     }
   inline int dump_one_block(BlockBuffer *item);
+  int init_compressor();
+  int dump_compressed_block(BlockBuffer *item, bool &dumped);
+  void free_compress_buf();
 
   int write_file(void *buf, int64_t size);
   int read_file(
@@ -1175,6 +1194,10 @@ private:
   ObSqlMemoryCallback *callback_;
   BatchCtx *batch_ctx_;
   Block *tmp_dump_blk_;
+  // compress blocks dumped to file, decided by tenant config when file is opened
+  common::ObCompressor *compressor_;
+  char *compress_buf_;
+  int64_t compress_buf_size_;
 
   DISALLOW_COPY_AND_ASSIGN(ObChunkDatumStore);
 };
@@ -14,6 +14,7 @@
 
 #include "ob_group_join_buffer.h"
 #include "sql/engine/ob_exec_context.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -116,7 +117,7 @@ ObGroupJoinBufffer::ObGroupJoinBufffer()
     right_cnt_(0), cur_group_idx_(0), left_store_read_(0),
     above_group_idx_for_expand_(0), above_group_idx_for_read_(0),
     above_group_size_(0), max_group_size_(0),
-    group_scan_size_(0), flags_(0)
+    group_scan_size_(0), cur_group_scan_size_(0), flags_(0)
 {
   need_check_above_ = true;
 }
@@ -156,6 +157,11 @@ int ObGroupJoinBufffer::init(ObOperator *op,
     right_rescan_params_ = right_rescan_params;
     ObSQLSessionInfo *session = ctx_->get_my_session();
     uint64_t tenant_id =session->get_effective_tenant_id();
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id));
+    if (tenant_config.is_valid()) {
+      enable_adaptive_group_size_ = tenant_config->_enable_adaptive_nlj_group_size;
+    }
+    reset_group_scan_size();
     lib::ContextParam param;
     param.set_mem_attr(tenant_id,
                        ObModIds::OB_SQL_NLJ_CACHE,
@@ -225,6 +231,7 @@ int ObGroupJoinBufffer::init_above_group_params()
                  K(left_group_size), K(right_group_size));
       } else {
         is_multi_level_ = true;
+        reset_group_scan_size();
       }
     }
   }
@@ -432,6 +439,7 @@ int ObGroupJoinBufffer::rescan_left()
         above_group_idx_for_expand_ = 0;
         above_group_idx_for_read_ = 0;
         reset_buffer_state();
+        reset_group_scan_size();
       }
     } else {
       if (OB_FAIL(drain_left())) {
@@ -553,6 +561,7 @@ int ObGroupJoinBufffer::fill_group_buffer()
         LOG_WARN("rescan right failed", KR(ret));
       } else {
         skip_rescan_right_ = true;
+        grow_group_scan_size();
       }
     }
     int save_ret = ret;
@@ -648,6 +657,7 @@ int ObGroupJoinBufffer::batch_fill_group_buffer(const int64_t max_row_cnt,
         LOG_WARN("rescan right failed", KR(ret));
       } else {
         skip_rescan_right_ = true;
+        grow_group_scan_size();
       }
     }
     int save_ret = ret;
@@ -969,6 +979,18 @@ int ObGroupJoinBufffer::set_above_group_size() {
   return ret;
 }
 
+// A left child which ends within the first small group is served like a plain
+// index nested loop join, without buffering and looking up a full group of rows
+// the parent may never consume (e.g. under LIMIT). A left child which keeps
+// filling the buffer ramps up to the full group size of batched DAS group scan.
+void ObGroupJoinBufffer::grow_group_scan_size()
+{
+  if (is_adaptive_group_size() && !is_left_end_ && is_full()
+      && cur_group_scan_size_ < group_scan_size_) {
+    cur_group_scan_size_ = MIN(cur_group_scan_size_ * 2, group_scan_size_);
+  }
+}
+
 void ObGroupJoinBufffer::reset_buffer_state()
 {
   cur_group_idx_ = 0;
@@ -62,6 +62,10 @@ private:
 class ObGroupJoinBufffer
 {
 public:
+  // with _enable_adaptive_nlj_group_size, the first group of every left iteration buffers
+  // at most MIN_GROUP_SCAN_SIZE rows, group size then doubles as long as the left child
+  // keeps filling the buffer.
+  static const int64_t MIN_GROUP_SCAN_SIZE = 64;
   ObGroupJoinBufffer();
   ~ObGroupJoinBufffer() {} // does not free memory
   int init(ObOperator *op,
@@ -71,7 +75,7 @@ public:
            const common::ObIArray<ObDynamicParamSetter> *left_rescan_params,
            const common::ObIArray<ObDynamicParamSetter> *right_rescan_params);
   bool is_inited() const { return is_inited_; }
-  bool is_full() const { return left_store_.get_row_cnt() >= group_scan_size_; }
+  bool is_full() const { return left_store_.get_row_cnt() >= cur_group_scan_size_; }
   bool need_fill_group_buffer() { return !(left_store_iter_.is_valid() && left_store_iter_.has_next()); }
   bool is_multi_level() const { return is_multi_level_; }
   int has_next_left_row(bool &has_next);
@@ -98,6 +102,14 @@ private:
                                int64_t &group_size);
   int set_above_group_size();
   void reset_buffer_state();
+  // multi level group rescan fills groups by above group size, never adapted
+  bool is_adaptive_group_size() const { return enable_adaptive_group_size_ && !is_multi_level_; }
+  void reset_group_scan_size()
+  {
+    cur_group_scan_size_ = is_adaptive_group_size() ? MIN(MIN_GROUP_SCAN_SIZE, group_scan_size_)
+                                                    : group_scan_size_;
+  }
+  void grow_group_scan_size();
   int backup_above_params(common::ObIArray<ObObjParam> &left_params_backup,
                           common::ObIArray<ObObjParam> &right_params_backup);
   int restore_above_params(common::ObIArray<ObObjParam> &left_params_backup,
@@ -153,6 +165,8 @@ private:
   int64_t above_group_size_;
   int64_t max_group_size_;
   int64_t group_scan_size_;
+  // group size adapted to the observed left cardinality, see grow_group_scan_size()
+  int64_t cur_group_scan_size_;
   union {
     uint64_t flags_;
     struct {
@@ -163,7 +177,8 @@ private:
       uint64_t save_last_row_                              : 1;
       uint64_t save_last_batch_                            : 1;
       uint64_t skip_rescan_right_                          : 1;
-      uint64_t reserved_                                   : 57;
+      uint64_t enable_adaptive_group_size_                 : 1;
+      uint64_t reserved_                                   : 56;
     };
   };
 };
@@ -400,9 +400,12 @@ public:
   { cur_side_ = InputSide::RIGHT; }
 
   int exists_row(const common::ObIArray<ObExpr*> &exprs, const HashCol *&exists_part_cols);
+  // hash_values_ready: hash values are already filled (e.g. by get_right_next_batch
+  // from dumped partition), no need to evaluate and hash the exprs again
   int exists_batch(const common::ObIArray<ObExpr*> &exprs, const int64_t batch_size,
                    const ObBitVector *child_skip, ObBitVector *skip,
-                   uint64_t *hash_values_for_batch);
+                   uint64_t *hash_values_for_batch,
+                   const bool hash_values_ready = false);
   OB_INLINE int64_t get_bucket_num() const { return hash_table_.get_bucket_num(); }
   int resize(int64_t bucket_cnt);
   int init_hash_table(int64_t bucket_cnt,
@@ -546,6 +549,10 @@ public:
   int get_right_next_batch(const common::ObIArray<ObExpr *> &exprs,
                            const int64_t max_row_cnt,
                            int64_t &read_rows);
+  int get_right_next_batch(const common::ObIArray<ObExpr *> &exprs,
+                           const int64_t max_row_cnt,
+                           int64_t &read_rows,
+                           uint64_t *hash_values_for_batch);
   // 实现对hash table数据进行遍历，其实可以支持多种方式
   // 如：
   //   1）hash table的bucket遍历
@@ -1637,7 +1644,8 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::exists_batch(
                    const int64_t batch_size,
                    const ObBitVector *child_skip,
                    ObBitVector *skip,
-                   uint64_t *hash_values_for_batch)
+                   uint64_t *hash_values_for_batch,
+                   const bool hash_values_ready)
 {
   int ret = OB_SUCCESS;
   if (OB_ISNULL(hash_values_for_batch)) {
@@ -1646,8 +1654,9 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::exists_batch(
   } else if (OB_ISNULL(skip)) {
     ret = OB_ERR_UNEXPECTED;
     SQL_ENG_LOG(WARN, "skip vector is null", K(ret));
-  } else if (OB_FAIL(calc_hash_value_for_batch(exprs, batch_size,
-                                              child_skip, hash_values_for_batch))) {
+  } else if (!hash_values_ready
+             && OB_FAIL(calc_hash_value_for_batch(exprs, batch_size,
+                                                  child_skip, hash_values_for_batch))) {
     SQL_ENG_LOG(WARN, "failed to calc hash values", K(ret));
   } else {
     const ObHashPartCols part_cols;
@@ -1655,13 +1664,27 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::exists_batch(
     const HashCol *exists_part_cols = nullptr;
     ObBitVector &skip_for_dump = *my_skip_;
     skip_for_dump.reset(batch_size);
+    const int64_t bucket_mask = hash_table_.get_bucket_num() - 1;
+    auto &buckets = hash_table_.buckets_;
     for (int i = 0; i < batch_size; ++i) {
       if (OB_NOT_NULL(child_skip) && child_skip->at(i)) {
         continue;
       }
-      __builtin_prefetch(hash_table_.buckets_->at(hash_values_for_batch[i]
-                                             & (hash_table_.get_bucket_num() - 1)), 0/* read */,
-                                             2 /*high temp locality*/);
+      __builtin_prefetch(buckets->at(hash_values_for_batch[i] & bucket_mask), 0/* read */,
+                         2 /*high temp locality*/);
+    }
+    // match flag of the stored row is read and written for every hit, prefetch it too
+    for (int i = 0; i < batch_size; ++i) {
+      if (OB_NOT_NULL(child_skip) && child_skip->at(i)) {
+        continue;
+      }
+      auto &curr_bkt = buckets->at(hash_values_for_batch[i] & bucket_mask);
+      if (nullptr == curr_bkt || curr_bkt->hash_value_ != hash_values_for_batch[i]) {
+        continue;
+      }
+      if (!curr_bkt->use_expr_) {
+        __builtin_prefetch(curr_bkt->store_row_, 1/* write */, 2 /*high temp locality*/);
+      }
     }
     {
       ObEvalCtx::BatchInfoScopeGuard guard(*eval_ctx_);
@@ -2467,6 +2490,39 @@ int ObHashPartInfrastructure<HashCol, HashRowStore>::get_right_next_batch(
   return ret;
 }
 
+template<typename HashCol, typename HashRowStore>
+int ObHashPartInfrastructure<HashCol, HashRowStore>::get_right_next_batch(
+                          const common::ObIArray<ObExpr *> &exprs,
+                          const int64_t max_row_cnt,
+                          int64_t &read_rows,
+                          uint64_t *hash_values_for_batch)
+{
+  int ret = OB_SUCCESS;
+  const ObChunkDatumStore::StoredRow *store_rows[max_row_cnt];
+  if (OB_ISNULL(hash_values_for_batch)) {
+    ret = OB_ERR_UNEXPECTED;
+    SQL_ENG_LOG(WARN, "hash values vector is not init", K(ret));
+  } else if (OB_ISNULL(cur_right_part_) || OB_ISNULL(eval_ctx_)) {
+    ret = OB_ERR_UNEXPECTED;
+    SQL_ENG_LOG(WARN, "unexpected status: current partition is null", K(cur_right_part_));
+  } else if (OB_FAIL(right_row_store_iter_.get_next_batch(exprs,
+                                                          *eval_ctx_,
+                                                          max_row_cnt,
+                                                          read_rows,
+                                                          &store_rows[0]))) {
+    if (OB_ITER_END != ret) {
+      SQL_ENG_LOG(WARN, "failed to get next batch", K(ret));
+    }
+  } else {
+    // dumped rows carry the hash value calculated before dumping
+    for (int64_t i = 0; i < read_rows; ++i) {
+      const HashRowStore *sr = static_cast<const HashRowStore *> (store_rows[i]);
+      hash_values_for_batch[i] = (sr->get_hash_value() & HashRowStore::get_hash_mask());
+    }
+  }
+  return ret;
+}
+
 template<typename HashCol, typename HashRowStore>
 int ObHashPartInfrastructure<HashCol, HashRowStore>::get_next_hash_table_row(
   const ObChunkDatumStore::StoredRow *&store_row,
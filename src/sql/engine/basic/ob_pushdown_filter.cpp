@@ -19,6 +19,8 @@
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 #include "storage/blocksstable/ob_datum_row.h"
 #include "sql/engine/expr/ob_expr_lob_utils.h"
+#include "sql/engine/expr/ob_expr_like.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
 
 namespace oceanbase
 {
@@ -105,7 +107,8 @@ const common::ObCmpOp ObPushdownWhiteFilterNode::WHITE_OP_TO_CMP_OP[] = {
   CO_MAX, // WHITE_OP_BT
   CO_MAX, // WHITE_OP_IN
   CO_MAX, // WHITE_OP_NU
-  CO_MAX  // WHITE_OP_NN
+  CO_MAX, // WHITE_OP_NN
+  CO_MAX  // WHITE_OP_LI
 };
 
 int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
@@ -139,6 +142,9 @@ int ObPushdownWhiteFilterNode::set_op_type(const ObItemType &type)
     case T_FUN_SYS_ISNULL:
       op_type_ = WHITE_OP_NU;
       break;
+    case T_OP_LIKE:
+      op_type_ = WHITE_OP_LI;
+      break;
     default:
       ret = OB_ERR_UNEXPECTED;
       break;
@@ -155,6 +161,11 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
   if (OB_ISNULL(raw_expr)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Invalid null argument", K(ret));
+  } else if (T_OP_LIKE == raw_expr->get_expr_type()) {
+    need_check = false;
+    if (OB_FAIL(is_white_like(raw_expr, is_white))) {
+      LOG_WARN("Failed to check white like expr", K(ret));
+    }
   } else if (1 >= raw_expr->get_param_count()) {
     need_check = false;
   } else if (OB_ISNULL(child = raw_expr->get_param_expr(0))) {
@@ -198,6 +209,41 @@ int ObPushdownFilterConstructor::is_white_mode(const ObRawExpr* raw_expr, bool &
   return ret;
 }
 
+// Only `varchar_column LIKE const_pattern [ESCAPE const_escape]` in mysql mode is pushed down as
+// white filter, pattern should have the same collation with column so no cast is needed.
+int ObPushdownFilterConstructor::is_white_like(const ObRawExpr* raw_expr, bool &is_white)
+{
+  int ret = OB_SUCCESS;
+  const ObRawExpr *col_expr = nullptr;
+  const ObRawExpr *pattern_expr = nullptr;
+  const ObRawExpr *escape_expr = nullptr;
+  is_white = false;
+  if (OB_ISNULL(raw_expr)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid null argument", K(ret));
+  } else if (OB_UNLIKELY(3 != raw_expr->get_param_count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected param count of like expr", K(ret), K(raw_expr->get_param_count()));
+  } else if (OB_ISNULL(col_expr = raw_expr->get_param_expr(0))
+             || OB_ISNULL(pattern_expr = raw_expr->get_param_expr(1))
+             || OB_ISNULL(escape_expr = raw_expr->get_param_expr(2))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null child expr", K(ret), KP(col_expr), KP(pattern_expr), KP(escape_expr));
+  } else if (lib::is_oracle_mode()) {
+  } else if (ObRawExpr::EXPR_COLUMN_REF != col_expr->get_expr_class()
+             || !pattern_expr->is_const_expr()
+             || !escape_expr->is_const_expr()) {
+  } else {
+    const ObObjMeta &col_meta = col_expr->get_result_meta();
+    const ObObjMeta &pattern_meta = pattern_expr->get_result_meta();
+    is_white = col_meta.is_varchar()
+        && (pattern_meta.is_null()
+            || (pattern_meta.is_varchar_or_char()
+                && pattern_meta.get_collation_type() == col_meta.get_collation_type()));
+  }
+  return ret;
+}
+
 int ObPushdownFilterConstructor::create_black_filter_node(
     ObRawExpr *raw_expr,
     ObPushdownFilterNode *&filter_node)
@@ -995,6 +1041,8 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
     check_null_params();
     if (WHITE_OP_IN == filter_.get_op_type() && OB_FAIL(init_obj_set())) {
       LOG_WARN("Failed to init Object hash set in filter node", K(ret));
+    } else if (WHITE_OP_LI == filter_.get_op_type() && OB_FAIL(init_like_pattern())) {
+      LOG_WARN("Failed to init like pattern in filter node", K(ret));
     }
   }
   return ret;
@@ -1003,7 +1051,9 @@ int ObWhiteFilterExecutor::init_evaluated_datums()
 void ObWhiteFilterExecutor::check_null_params()
 {
   null_param_contained_ = false;
-  for (int64_t i = 0; !null_param_contained_ && i < params_.count(); i++) {
+  // null escape of LIKE means default escape, only the pattern matters
+  const int64_t check_cnt = WHITE_OP_LI == filter_.get_op_type() ? MIN(1, params_.count()) : params_.count();
+  for (int64_t i = 0; !null_param_contained_ && i < check_cnt; i++) {
     if ((lib::is_mysql_mode() && params_.at(i).is_null())
         || (lib::is_oracle_mode() && params_.at(i).is_null_oracle())) {
       null_param_contained_ = true;
@@ -1033,6 +1083,80 @@ int ObWhiteFilterExecutor::init_obj_set()
   return ret;
 }
 
+int ObWhiteFilterExecutor::init_like_pattern()
+{
+  int ret = OB_SUCCESS;
+  is_prefix_like_ = false;
+  like_prefix_.reset();
+  like_escape_wc_ = 0;
+  if (OB_UNLIKELY(2 != params_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected param count for like filter", K(ret), K_(params));
+  } else if (null_param_contained_) {
+    // null pattern, all rows are filtered
+  } else {
+    const ObObj &pattern = params_.at(0);
+    const ObObj &escape = params_.at(1);
+    const ObCollationType cs_type = pattern.get_collation_type();
+    ObString escape_val;
+    if (escape.is_null() || escape.get_string().empty()) {
+      escape_val.assign_ptr("\\", 1);
+    } else {
+      escape_val = escape.get_string();
+    }
+    if (OB_FAIL(ObExprLike::calc_escape_wc(escape.is_null() ? cs_type : escape.get_collation_type(),
+                                           escape_val, like_escape_wc_))) {
+      LOG_WARN("Failed to calc escape wc", K(ret), K(escape_val));
+      LOG_USER_ERROR(OB_INVALID_ARGUMENT, "ESCAPE");
+    } else if (ObCharset::is_bin_sort(cs_type)
+               && (CHARSET_BINARY == ObCharset::charset_type_by_coll(cs_type)
+                   || CHARSET_UTF8MB4 == ObCharset::charset_type_by_coll(cs_type))
+               && like_escape_wc_ < 0x80) {
+      // single byte wildcards and escape never appear inside a multi-byte character for these
+      // charsets, so the pattern can be checked byte by byte
+      const ObString pattern_val = pattern.get_string();
+      const char *ptr = pattern_val.ptr();
+      const int64_t len = pattern_val.length();
+      int64_t prefix_len = 0;
+      bool has_special = false;
+      while (prefix_len < len && '%' != ptr[prefix_len] && !has_special) {
+        has_special = ('_' == ptr[prefix_len] || like_escape_wc_ == ptr[prefix_len]);
+        ++prefix_len;
+      }
+      if (!has_special && prefix_len < len) {
+        int64_t pos = prefix_len;
+        while (pos < len && '%' == ptr[pos]) {
+          ++pos;
+        }
+        if (pos == len) {
+          is_prefix_like_ = true;
+          like_prefix_.assign_ptr(ptr, static_cast<int32_t>(prefix_len));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+bool ObWhiteFilterExecutor::like_match(const ObString &str) const
+{
+  bool is_match = false;
+  if (is_prefix_like_) {
+    is_match = str.length() >= like_prefix_.length()
+        && 0 == MEMCMP(str.ptr(), like_prefix_.ptr(), like_prefix_.length());
+  } else {
+    const ObString &pattern = params_.at(0).get_string();
+    if (str.empty() && pattern.empty()) {
+      is_match = true;
+    } else {
+      is_match = ObCharset::wildcmp(params_.at(0).get_collation_type(), str, pattern,
+                                    like_escape_wc_, static_cast<int32_t>('_'),
+                                    static_cast<int32_t>('%'));
+    }
+  }
+  return is_match;
+}
+
 int ObWhiteFilterExecutor::exist_in_obj_set(const ObObj &obj, bool &is_exist) const
 {
   int ret = param_set_.exist_refactored(obj);
@@ -1085,6 +1209,32 @@ int ObBlackFilterExecutor::filter(ObEvalCtx &eval_ctx, bool &filtered)
   return ret;
 }
 
+int ObBlackFilterExecutor::filter_by_min_max(const ObDatum &min, const ObDatum &max, bool &filtered)
+{
+  int ret = OB_SUCCESS;
+  filtered = false;
+  if (1 != filter_.column_exprs_.count()) {
+  } else {
+    ObEvalCtx &eval_ctx = op_.get_eval_ctx();
+    for (int64_t i = 0; OB_SUCC(ret) && !filtered && i < filter_.filter_exprs_.count(); ++i) {
+      const ObExpr *e = filter_.filter_exprs_.at(i);
+      bool is_match = true;
+      if (OB_ISNULL(e)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected null filter expr", K(ret), K(i));
+      } else if (T_OP_RUNTIME_FILTER != e->type_ || 1 != e->arg_cnt_
+                 || e->args_[0] != filter_.column_exprs_.at(0)) {
+        // only runtime range and in filter on the column itself can be checked with min/max
+      } else if (OB_FAIL(ObExprJoinFilter::might_contain_range(*e, eval_ctx, min, max, is_match))) {
+        LOG_WARN("failed to check runtime filter with min max", K(ret));
+      } else {
+        filtered = !is_match;
+      }
+    }
+  }
+  return ret;
+}
+
 // 提供给存储如果发现是黑盒filter，则调用该接口来判断是否被过滤掉
 int ObBlackFilterExecutor::filter(ObObj *objs, int64_t col_cnt, bool &filtered)
 {
@@ -1503,8 +1653,99 @@ OB_DEF_SERIALIZE_SIZE(ObPushdownExprSpec)
   return len;
 }
 
+int ObPushdownTopNFilter::init(
+    const ObExpr *key_expr,
+    const ObDatumCmpFuncType cmp_func,
+    const bool is_ascending,
+    ObIAllocator &alloc)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(key_expr) || OB_ISNULL(cmp_func)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(key_expr), KP(cmp_func));
+  } else {
+    key_expr_ = key_expr;
+    col_id_ = OB_INVALID_ID;
+    cmp_func_ = cmp_func;
+    is_ascending_ = is_ascending;
+    has_boundary_ = false;
+    alloc_ = &alloc;
+  }
+  return ret;
+}
+
+int ObPushdownTopNFilter::update_boundary(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(alloc_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("topn filter not init", K(ret));
+  } else if (datum.is_null()) {
+    boundary_.set_null();
+    has_boundary_ = true;
+  } else {
+    if (datum.len_ > buf_size_) {
+      const int64_t new_size = MAX(datum.len_, buf_size_ * 2);
+      char *new_buf = static_cast<char *>(alloc_->alloc(new_size));
+      if (OB_ISNULL(new_buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc memory", K(ret), K(new_size));
+      } else {
+        if (nullptr != buf_) {
+          alloc_->free(buf_);
+        }
+        buf_ = new_buf;
+        buf_size_ = new_size;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      MEMCPY(buf_, datum.ptr_, datum.len_);
+      boundary_.pack_ = datum.pack_;
+      boundary_.ptr_ = buf_;
+      has_boundary_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObPushdownTopNFilter::check_min_max(
+    const ObDatum &min,
+    const ObDatum &max,
+    const bool has_null,
+    bool &can_skip) const
+{
+  int ret = OB_SUCCESS;
+  int cmp = 0;
+  ObDatum null_datum;
+  null_datum.set_null();
+  can_skip = false;
+  if (!has_boundary_) {
+  } else if (is_ascending_) {
+    // the smallest value of the block, null included, must sort after the boundary
+    if (OB_FAIL(cmp_func_(min, boundary_, cmp))) {
+      LOG_WARN("failed to compare", K(ret), K(min), K_(boundary));
+    } else if (cmp <= 0) {
+    } else if (has_null && OB_FAIL(cmp_func_(null_datum, boundary_, cmp))) {
+      LOG_WARN("failed to compare", K(ret), K_(boundary));
+    } else {
+      can_skip = cmp > 0;
+    }
+  } else {
+    if (OB_FAIL(cmp_func_(max, boundary_, cmp))) {
+      LOG_WARN("failed to compare", K(ret), K(max), K_(boundary));
+    } else if (cmp >= 0) {
+    } else if (has_null && OB_FAIL(cmp_func_(null_datum, boundary_, cmp))) {
+      LOG_WARN("failed to compare", K(ret), K_(boundary));
+    } else {
+      can_skip = cmp < 0;
+    }
+  }
+  return ret;
+}
+
 ObPushdownOperator::ObPushdownOperator(ObEvalCtx &eval_ctx, const ObPushdownExprSpec &expr_spec)
   : pd_storage_filters_(nullptr),
+    topn_filter_(nullptr),
     eval_ctx_(eval_ctx),
     expr_spec_(expr_spec)
 {
@@ -90,6 +90,30 @@ public:
   { return pd_storage_flag & 0x02; }
   OB_INLINE static bool is_aggregate_pushdown_storage(int32_t pd_storage_flag)
   { return pd_storage_flag & 0x04; }
+  // storage sums int/uint/float/double/number columns, avg is rewritten to sum/count before pushdown
+  OB_INLINE static bool is_sum_pushdown_supported(
+      const common::ObObjType param_type,
+      const common::ObObjType result_type)
+  {
+    bool bret = false;
+    switch (common::ob_obj_type_class(param_type)) {
+      case common::ObIntTC:
+      case common::ObUIntTC:
+      case common::ObNumberTC: {
+        bret = common::ObNumberType == result_type;
+        break;
+      }
+      case common::ObFloatTC:
+      case common::ObDoubleTC: {
+        bret = common::ObFloatType == result_type || common::ObDoubleType == result_type;
+        break;
+      }
+      default: {
+        bret = false;
+      }
+    }
+    return bret;
+  }
 };
 
 class ObPushdownFilterNode
@@ -174,7 +198,7 @@ enum ObWhiteFilterOperatorType
   WHITE_OP_IN, // in (1, 2, 3)
   WHITE_OP_NU, // is null
   WHITE_OP_NN, // is not null
-  // WHITE_OP_LI, // like
+  WHITE_OP_LI, // like
   WHITE_OP_MAX,
 };
 class ObPushdownWhiteFilterNode : public ObPushdownFilterNode
@@ -247,6 +271,7 @@ public:
 
 private:
   int is_white_mode(const ObRawExpr* raw_expr, bool &is_white);
+  int is_white_like(const ObRawExpr* raw_expr, bool &is_white);
   int create_black_filter_node(ObRawExpr *raw_expr, ObPushdownFilterNode *&filter_tree);
   int create_white_filter_node(ObRawExpr *raw_expr, ObPushdownFilterNode *&filter_tree);
   int merge_filter_node(
@@ -403,6 +428,9 @@ public:
   { return filter_.get_col_ids(); }
   int filter(common::ObObj *objs, int64_t col_cnt, bool &ret_val);
   int filter(blocksstable::ObStorageDatum *datums, int64_t col_cnt, bool &ret_val);
+  // check whether all rows with value of the only column in [min, max] are filtered,
+  // only runtime filter is supported now
+  int filter_by_min_max(const common::ObDatum &min, const common::ObDatum &max, bool &filtered);
   virtual int init_evaluated_datums() override;
   OB_INLINE bool can_vectorized();
   int filter_batch(ObPushdownFilterExecutor *parent,
@@ -436,7 +464,8 @@ public:
                         ObPushdownWhiteFilterNode &filter,
                         ObPushdownOperator &op)
       : ObPushdownFilterExecutor(alloc, op, PushdownExecutorType::WHITE_FILTER_EXECUTOR),
-      null_param_contained_(false), params_(alloc), filter_(filter) {}
+      null_param_contained_(false), params_(alloc), filter_(filter),
+      like_escape_wc_(0), is_prefix_like_(false), like_prefix_() {}
   ~ObWhiteFilterExecutor()
   {
     params_.reset();
@@ -456,17 +485,26 @@ public:
   bool is_obj_set_created() const { return param_set_.created(); };
   OB_INLINE ObWhiteFilterOperatorType get_op_type() const
   { return filter_.get_op_type(); }
+  // LIKE 'prefix%' on binary sorted collation, can be matched by bytes comparison on prefix
+  OB_INLINE bool is_prefix_like() const { return is_prefix_like_; }
+  OB_INLINE const common::ObString &get_like_prefix() const { return like_prefix_; }
+  bool like_match(const common::ObString &str) const;
   INHERIT_TO_STRING_KV("ObPushdownWhiteFilterExecutor", ObPushdownFilterExecutor,
                        K_(null_param_contained), K_(params), K(param_set_.created()),
+                       K_(like_escape_wc), K_(is_prefix_like), K_(like_prefix),
                        K_(filter));
 private:
   void check_null_params();
   int init_obj_set();
+  int init_like_pattern();
 private:
   bool null_param_contained_;
   common::ObFixedArray<common::ObObj, common::ObIAllocator> params_;
   common::hash::ObHashSet<common::ObObj> param_set_;
   ObPushdownWhiteFilterNode &filter_;
+  int32_t like_escape_wc_;
+  bool is_prefix_like_;
+  common::ObString like_prefix_;
 };
 
 class ObAndFilterExecutor : public ObPushdownFilterExecutor
@@ -559,6 +597,47 @@ public:
   ObExpr *trans_info_expr_;
 };
 
+// Boundary of the first sort key of a top-n sort right above the table scan.
+// Updated by the sort operator when the top-n heap is full or its top row is replaced,
+// storage skips micro blocks whose min/max of the column can not beat the boundary.
+class ObPushdownTopNFilter
+{
+public:
+  ObPushdownTopNFilter()
+    : key_expr_(nullptr), col_id_(common::OB_INVALID_ID), cmp_func_(nullptr),
+      is_ascending_(true), has_boundary_(false), boundary_(), buf_(nullptr),
+      buf_size_(0), alloc_(nullptr)
+  {}
+  ~ObPushdownTopNFilter() = default;
+  int init(const ObExpr *key_expr,
+           const common::ObDatumCmpFuncType cmp_func,
+           const bool is_ascending,
+           common::ObIAllocator &alloc);
+  void reset_boundary() { has_boundary_ = false; }
+  // deep copy the first sort key of the n-th row
+  int update_boundary(const common::ObDatum &datum);
+  // can_skip is true if no value in [min, max] (and null if has_null) sorts before the boundary
+  int check_min_max(const common::ObDatum &min,
+                    const common::ObDatum &max,
+                    const bool has_null,
+                    bool &can_skip) const;
+  OB_INLINE const ObExpr *get_key_expr() const { return key_expr_; }
+  OB_INLINE uint64_t get_col_id() const { return col_id_; }
+  OB_INLINE void set_col_id(const uint64_t col_id) { col_id_ = col_id; }
+  TO_STRING_KV(KP_(key_expr), K_(col_id), K_(is_ascending), K_(has_boundary), K_(boundary));
+private:
+  const ObExpr *key_expr_;
+  uint64_t col_id_;
+  common::ObDatumCmpFuncType cmp_func_;
+  bool is_ascending_;
+  bool has_boundary_;
+  common::ObDatum boundary_;
+  char *buf_;
+  int64_t buf_size_;
+  common::ObIAllocator *alloc_;
+  DISALLOW_COPY_AND_ASSIGN(ObPushdownTopNFilter);
+};
+
 //下压到存储层的表达式执行依赖的op ctx
 class ObPushdownOperator
 {
@@ -584,6 +663,8 @@ public:
   int write_trans_info_datum(blocksstable::ObDatumRow &out_row);
 public:
   ObPushdownFilterExecutor *pd_storage_filters_;
+  // set by top-n sort above, only used by local scan
+  ObPushdownTopNFilter *topn_filter_;
   ObEvalCtx &eval_ctx_;
   const ObPushdownExprSpec &expr_spec_;
   // The datum of the trans_info expression that records transaction information
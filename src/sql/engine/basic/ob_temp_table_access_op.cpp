@@ -202,6 +202,7 @@ int ObTempTableAccessOp::inner_close()
 void ObTempTableAccessOp::destroy()
 {
   result_info_guard_.reset();
+  cur_result_id_ = OB_INVALID_ID;
   ObOperator::destroy();
 }
 
@@ -361,13 +362,24 @@ int ObTempTableAccessOp::locate_interm_result(int64_t result_id)
   dtl::ObDTLIntermResultInfo *result_info = NULL;
   dtl_int_key.channel_id_ = result_id;
   datum_store_it_.reset();
-  // The current operation of obtaining intermediate results and
-  // the operation of the background thread of dumping intermediate results
-  // are mutually exclusive
-  if (OB_FAIL(dtl::ObDTLIntermResultManager::getInstance().atomic_get_interm_result_info(
-       dtl_int_key, result_info_guard_))) {
-    LOG_WARN("failed to create row store.", K(ret));
-  } else if (FALSE_IT(result_info = result_info_guard_.result_info_)) {
+  if (NULL != result_info_guard_.result_info_
+      && cur_result_id_ == static_cast<uint64_t>(result_id)) {
+    // rescan读取同一个中间结果, guard仍持有引用且结果已标记为已读(不会被dump), 直接复用
+    result_info = result_info_guard_.result_info_;
+  } else {
+    cur_result_id_ = OB_INVALID_ID;
+    // The current operation of obtaining intermediate results and
+    // the operation of the background thread of dumping intermediate results
+    // are mutually exclusive
+    if (OB_FAIL(dtl::ObDTLIntermResultManager::getInstance().atomic_get_interm_result_info(
+         dtl_int_key, result_info_guard_))) {
+      LOG_WARN("failed to create row store.", K(ret));
+    } else {
+      result_info = result_info_guard_.result_info_;
+      cur_result_id_ = result_id;
+    }
+  }
+  if (OB_FAIL(ret)) {
   // After getting the intermediate result, need to judge whether the result is readable.
   } else if (OB_SUCCESS != result_info->ret_) {
     ret = result_info->ret_;
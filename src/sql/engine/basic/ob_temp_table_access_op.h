@@ -90,7 +90,8 @@ public:
       can_rescan_(false),
       is_started_(false),
       stored_rows_(NULL),
-      result_info_guard_() {}
+      result_info_guard_(),
+      cur_result_id_(common::OB_INVALID_ID) {}
   ~ObTempTableAccessOp() {}
 
   virtual int inner_open() override;
@@ -114,6 +115,8 @@ private:
   bool is_started_;
   const ObChunkDatumStore::StoredRow **stored_rows_;
   dtl::ObDTLIntermResultInfoGuard result_info_guard_;
+  //result_info_guard_当前持有的result id, rescan命中时直接复用, 不再访问全局中间结果管理器
+  uint64_t cur_result_id_;
 };
 
 } // end namespace sql
@@ -277,6 +277,39 @@ int ObExprJoinFilter::eval_filter_internal(const ObExpr &expr, ObEvalCtx &ctx, O
   return ret;
 }
 
+int ObExprJoinFilter::might_contain_range(
+    const ObExpr &expr,
+    ObEvalCtx &ctx,
+    const ObDatum &min,
+    const ObDatum &max,
+    bool &is_match)
+{
+  int ret = OB_SUCCESS;
+  uint64_t op_id = expr.expr_ctx_id_;
+  ObExecContext &exec_ctx = ctx.exec_ctx_;
+  ObExprJoinFilterContext *join_filter_ctx = NULL;
+  is_match = true;
+  if (OB_ISNULL(join_filter_ctx = static_cast<ObExprJoinFilterContext *>(
+            exec_ctx.get_expr_op_ctx(op_id)))) {
+    // join filter ctx may be null in das.
+  } else if (1 != expr.arg_cnt_) {
+  } else {
+    if (join_filter_ctx->is_first_) {
+      join_filter_ctx->start_time_ = ObTimeUtility::current_time();
+      join_filter_ctx->is_first_ = false;
+    }
+    if (OB_FAIL(check_rf_ready(exec_ctx, join_filter_ctx))) {
+      LOG_WARN("fail to check rf ready", K(ret));
+    } else if (OB_ISNULL(join_filter_ctx->rf_msg_)) {
+    } else if (!join_filter_ctx->is_ready() || join_filter_ctx->dynamic_disable()) {
+    } else if (OB_FAIL(join_filter_ctx->rf_msg_->might_contain_range(min, max, *join_filter_ctx,
+                                                                     is_match))) {
+      LOG_WARN("fail to check contain range", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObExprJoinFilter::eval_bloom_filter_batch(
     const ObExpr &expr,
     ObEvalCtx &ctx,
@@ -110,6 +110,12 @@ public:
   static int eval_filter_batch_internal(
              const ObExpr &expr, ObEvalCtx &ctx, const ObBitVector &skip, const int64_t batch_size);
 
+  // Check whether rows with value of the only filter column in [min, max] may pass the
+  // runtime filter, used by storage to skip micro blocks with skip index.
+  static int might_contain_range(
+             const ObExpr &expr, ObEvalCtx &ctx, const ObDatum &min, const ObDatum &max,
+             bool &is_match);
+
   virtual int cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw_expr,
                       ObExpr &rt_expr) const override;
   virtual bool need_rt_ctx() const override { return true; }
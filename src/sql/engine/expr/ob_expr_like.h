@@ -157,6 +157,9 @@ public:
   static int like_text_vectorized_inner(const ObExpr &expr, ObEvalCtx &ctx,
                                         const ObBitVector &skip, const int64_t size,
                                         ObExpr &text, ObDatum *pattern_datum, ObDatum *escape_datum);
+  static int calc_escape_wc(const common::ObCollationType escape_coll,
+                            const common::ObString &escape,
+                            int32_t &escape_wc);
 private:
   static int set_instr_info(common::ObIAllocator *exec_allocator,
                             const common::ObCollationType cs_type,
@@ -169,9 +172,6 @@ private:
                        int32_t char_len,
                        int32_t escape_wc,
                        bool &res);
-  static int calc_escape_wc(const common::ObCollationType escape_coll,
-                            const common::ObString &escape,
-                            int32_t &escape_wc);
   template <typename T>
   inline static int calc_with_instr_mode(T &result,
                                           const common::ObCollationType cs_type,
@@ -3421,25 +3421,17 @@ int ObSubQueryRelationalExpr::check_exists(const ObExpr &expr, ObEvalCtx &ctx, b
   } else if (OB_ISNULL(iter)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("NULL subquery iterator", K(ret));
-  } else if (OB_FAIL(iter->rewind())) {
-      LOG_WARN("start iterate failed", K(ret));
   } else {
+    ObDatum out;
     bool found_in_hash_map = false;
     bool is_hash_enabled = iter->has_hashmap();
-    if (is_hash_enabled) {
-      ObDatum out;
-      if (OB_FAIL(iter->get_curr_probe_row())) {
-        LOG_WARN("failed to get probe row", K(ret));
-      } else if (OB_FAIL(iter->get_refactored(out))) {
-        if (OB_HASH_NOT_EXIST != ret) {
-          LOG_WARN("failed to find in hash map", K(ret));
-        } else {
-          ret = OB_SUCCESS;
-        }
-      } else {
-        found_in_hash_map = true;
-        exists = out.get_bool();
-      }
+    if (OB_FAIL(iter->probe_hashmap(out, found_in_hash_map))) {
+      LOG_WARN("failed to probe hash map", K(ret));
+    } else if ((!found_in_hash_map || iter->need_rewind_on_hit()) && OB_FAIL(iter->rewind())) {
+      // subquery is not rewound if result of current exec params is cached
+      LOG_WARN("start iterate failed", K(ret));
+    } else if (found_in_hash_map) {
+      exists = out.get_bool();
     }
     if (OB_FAIL(ret) || found_in_hash_map) {
     } else if (OB_FAIL(iter->get_next_row())) {
@@ -304,6 +304,8 @@ int ObExprSubQueryRef::expr_eval(
   const ExtraInfo *extra_info = static_cast<ExtraInfo *>(expr.extra_info_);
   ObDatum *datum = NULL;
   ObSubQueryIterator *iter = NULL;
+  ObDatum out;
+  bool found_in_hash_map = false;
   //对所有iter 进行reset操作
   if (OB_ISNULL(extra_info)) {
     ret = OB_ERR_UNEXPECTED;
@@ -313,7 +315,11 @@ int ObExprSubQueryRef::expr_eval(
   } else if (OB_ISNULL(iter)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("null iter returned", K(ret));
-  } else if (OB_FAIL(iter->rewind())) {
+  } else if (extra.is_scalar_ && 1 == iter->get_output().count()
+             && OB_FAIL(iter->probe_hashmap(out, found_in_hash_map))) {
+    LOG_WARN("failed to probe hash map", K(ret));
+  } else if ((!found_in_hash_map || iter->need_rewind_on_hit()) && OB_FAIL(iter->rewind())) {
+    // subquery is not rewound if result of current exec params is cached
     LOG_WARN("filter to rewind subquery iterator", K(ret));
   }
   if (OB_FAIL(ret)) {
@@ -324,24 +330,9 @@ int ObExprSubQueryRef::expr_eval(
       LOG_USER_ERROR(OB_ERR_INVALID_COLUMN_NUM, 1L);
     } else {
       bool iter_end = false;
-      bool found_in_hash_map = false;
       bool is_hash_enabled = iter->has_hashmap();
-      if (is_hash_enabled) {
-        ObDatum out;
-        if (OB_FAIL(iter->get_curr_probe_row())) {
-          LOG_WARN("failed to get probe row", K(ret));
-        } else if (OB_FAIL(iter->get_refactored(out))) {
-          if (OB_HASH_NOT_EXIST != ret) {
-            LOG_WARN("failed to find in hash map", K(ret));
-          } else {
-            ret = OB_SUCCESS;
-          }
-        } else {
-          found_in_hash_map = true;
-          if (OB_FAIL(expr.deep_copy_datum(ctx, out))) {
-            LOG_WARN("failed to deep copy datum", K(ret));
-          }
-        }
+      if (found_in_hash_map && OB_FAIL(expr.deep_copy_datum(ctx, out))) {
+        LOG_WARN("failed to deep copy datum", K(ret));
       }
       if (OB_FAIL(ret) || found_in_hash_map) {
       } else if (OB_FAIL(iter->get_next_row())) {
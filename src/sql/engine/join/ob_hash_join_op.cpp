@@ -230,6 +230,7 @@ ObHashJoinOp::ObHashJoinOp(ObExecContext &ctx_, const ObOpSpec &spec, ObOpInput
   cur_right_hist_(nullptr),
   cur_probe_row_idx_(0),
   max_right_bucket_idx_(0),
+  shared_build_range_shift_(0),
   probe_cnt_(0),
   bitset_filter_cnt_(0),
   hash_link_cnt_(0),
@@ -1740,6 +1741,14 @@ int ObHashJoinOp::build_hash_table_in_memory(int64_t &num_left_rows)
     // do nothing
   } else {
     PartHashJoinTable &hash_table = *cur_hash_table_;
+    HashJoinHistogram shared_build_hist;
+    int64_t nth_hist_row = 0;
+    const bool use_shared_build_hist = 0 == hj_batch->get_row_count_on_disk()
+                                      && need_shared_build_hist(hj_batch->get_row_count_in_memory());
+    if (use_shared_build_hist
+        && OB_FAIL(init_shared_build_hist(shared_build_hist, hj_batch->get_row_count_in_memory()))) {
+      LOG_WARN("failed to init shared build histogram", K(ret));
+    }
     ObChunkDatumStore::IterationAge iter_age;
     hj_batch->set_iteration_age(iter_age);
     while (OB_SUCC(ret)) {
@@ -1764,6 +1773,13 @@ int ObHashJoinOp::build_hash_table_in_memory(int64_t &num_left_rows)
         if (OB_SUCC(ret)) {
           if (OB_UNLIKELY(NULL == hash_table.buckets_)) {
             // do nothing
+          } else if (use_shared_build_hist) {
+            if (OB_FAIL(add_shared_build_hist_rows(shared_build_hist,
+                                                   left_stored_rows,
+                                                   read_size,
+                                                   nth_hist_row))) {
+              LOG_WARN("failed to add rows to shared build histogram", K(ret));
+            }
           } else {
             auto mask = hash_table.nbuckets_ - 1;
             for(auto i = 0; i < read_size; i++) {
@@ -1788,6 +1804,13 @@ int ObHashJoinOp::build_hash_table_in_memory(int64_t &num_left_rows)
         }
       }
     }
+    if (OB_ITER_END == ret && use_shared_build_hist && OB_NOT_NULL(hash_table.buckets_)) {
+      if (OB_FAIL(insert_shared_build_hist(shared_build_hist, nth_hist_row, used_buckets, collisions))) {
+        LOG_WARN("failed to insert shared build histogram", K(ret));
+      } else {
+        ret = OB_ITER_END;
+      }
+    }
     if (OB_SUCC(ret) || OB_ITER_END == ret) {
       if (is_shared_) {
         ATOMIC_AAF(&hash_table.used_buckets_, used_buckets);
@@ -2909,6 +2932,19 @@ int ObHashJoinOp::build_hash_table_for_recursive()
   int64_t step = 64;
   int64_t used_buckets = 0;
   int64_t collisions = 0;
+  HashJoinHistogram shared_build_hist;
+  int64_t nth_hist_row = 0;
+  bool use_shared_build_hist = false;
+  if (is_shared_ && OB_NOT_NULL(hash_table.buckets_)) {
+    int64_t row_count_in_memory = 0;
+    for (int64_t i = 0; i < part_count_; ++i) {
+      row_count_in_memory += hj_part_array_[i].get_row_count_in_memory();
+    }
+    use_shared_build_hist = need_shared_build_hist(row_count_in_memory);
+    if (use_shared_build_hist && OB_FAIL(init_shared_build_hist(shared_build_hist, row_count_in_memory))) {
+      LOG_WARN("failed to init shared build histogram", K(ret));
+    }
+  }
   for (int64_t i = start_id, idx = 0; OB_SUCC(ret) && idx < part_count_; ++idx, ++i) {
     i = i % part_count_;
     ObHashJoinPartition &hj_part = hj_part_array_[i];
@@ -2950,6 +2986,13 @@ int ObHashJoinOp::build_hash_table_for_recursive()
             if (OB_SUCC(ret)) {
               if (OB_UNLIKELY(NULL == hash_table.buckets_)) {
                 // do nothing
+              } else if (use_shared_build_hist) {
+                if (OB_FAIL(add_shared_build_hist_rows(shared_build_hist,
+                                                       part_stored_rows,
+                                                       read_size,
+                                                       nth_hist_row))) {
+                  LOG_WARN("failed to add rows to shared build histogram", K(ret));
+                }
               } else {
                 auto mask = hash_table.nbuckets_ - 1;
                 for(auto i = 0; i < read_size; i++) {
@@ -2990,6 +3033,10 @@ int ObHashJoinOp::build_hash_table_for_recursive()
   // 在in-memory情况下需要根据join type(right (anti,outer等) join)是否需要返回数据
   // nest loop情况下只有最后一个chunk才需要，而recursive的in-memory数据一定需要，所以这里设为true
   is_last_chunk_ = true;
+  if (OB_SUCC(ret) && use_shared_build_hist
+      && OB_FAIL(insert_shared_build_hist(shared_build_hist, nth_hist_row, used_buckets, collisions))) {
+    LOG_WARN("failed to insert shared build histogram", K(ret));
+  }
   if (OB_SUCC(ret)) {
     if (is_shared_ ) {
       ATOMIC_AAF(&hash_table.used_buckets_, used_buckets);
@@ -3005,6 +3052,106 @@ int ObHashJoinOp::build_hash_table_for_recursive()
   return ret;
 }
 
+bool ObHashJoinOp::need_shared_build_hist(const int64_t row_count) const
+{
+  return is_shared_
+      && !read_null_in_naaj_
+      && row_count >= SHARED_BUILD_HIST_MIN_ROW_CNT
+      && OB_NOT_NULL(cur_hash_table_)
+      && cur_hash_table_->nbuckets_ >= SHARED_BUILD_MAX_RANGE_CNT;
+}
+
+int ObHashJoinOp::init_shared_build_hist(HashJoinHistogram &hist, const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(cur_hash_table_)
+      || OB_UNLIKELY(cur_hash_table_->nbuckets_ < SHARED_BUILD_MAX_RANGE_CNT)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected hash table for shared build", K(ret), KP(cur_hash_table_));
+  } else if (OB_FAIL(hist.init(alloc_, row_count, SHARED_BUILD_MAX_RANGE_CNT, false))) {
+    LOG_WARN("failed to init shared build histogram", K(ret), K(row_count));
+  } else {
+    // nbuckets_ and range count are both power of 2
+    shared_build_range_shift_ = __builtin_ctzll(cur_hash_table_->nbuckets_)
+                                - __builtin_ctzll(SHARED_BUILD_MAX_RANGE_CNT);
+  }
+  return ret;
+}
+
+int ObHashJoinOp::add_shared_build_hist_rows(
+  HashJoinHistogram &hist,
+  const ObHashJoinStoredJoinRow **stored_rows,
+  const int64_t read_size,
+  int64_t &nth_row)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nth_row + read_size > hist.row_count_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("row count exceed shared build histogram", K(ret), K(nth_row), K(read_size),
+      K(hist.row_count_));
+  } else {
+    for (int64_t i = 0; i < read_size; ++i) {
+      HistItem &hist_item = hist.h1_->at(nth_row + i);
+      hist_item.hash_value_ = stored_rows[i]->get_hash_value();
+      hist_item.store_row_ = const_cast<ObHashJoinStoredJoinRow *>(stored_rows[i]);
+      ++hist.prefix_hist_count_->at(get_shared_build_range_idx(hist_item.hash_value_));
+    }
+    nth_row += read_size;
+  }
+  return ret;
+}
+
+int ObHashJoinOp::insert_shared_build_hist(
+  HashJoinHistogram &hist,
+  const int64_t nth_row,
+  int64_t &used_buckets,
+  int64_t &collisions)
+{
+  int ret = OB_SUCCESS;
+  ObHashJoinInput *hj_input = static_cast<ObHashJoinInput*>(input_);
+  PartHashJoinTable &hash_table = *cur_hash_table_;
+  auto range_func = [&](int64_t hash_value, int64_t nth) {
+    UNUSED(nth);
+    return get_shared_build_range_idx(hash_value);
+  };
+  if (OB_UNLIKELY(nth_row != hist.row_count_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("expect row count is match", K(ret), K(nth_row), K(hist.row_count_));
+  } else if (hist.empty()) {
+    // do nothing
+  } else if (OB_FAIL(hist.reorder_histogram(range_func))) {
+    LOG_WARN("failed to reorder shared build histogram", K(ret));
+  } else {
+    // after reorder, rows are ordered by bucket range in h2_ and prefix_hist_count_
+    // is the end offset of each range.
+    // Workers start from different ranges to avoid CAS on the same buckets.
+    const int64_t PREFETCH_BATCH_SIZE = 64;
+    const uint64_t mask = hash_table.nbuckets_ - 1;
+    const int64_t range_cnt = hist.prefix_hist_count_->count();
+    const int64_t start_range = hj_input->get_task_id() * range_cnt
+                                / hj_input->get_sqc_thread_count();
+    for (int64_t idx = 0; idx < range_cnt; ++idx) {
+      const int64_t range_idx = (start_range + idx) % range_cnt;
+      const int64_t start_idx = 0 == range_idx ? 0 : hist.prefix_hist_count_->at(range_idx - 1);
+      const int64_t end_idx = hist.prefix_hist_count_->at(range_idx);
+      for (int64_t i = start_idx; i < end_idx; i += PREFETCH_BATCH_SIZE) {
+        const int64_t batch_end = MIN(end_idx, i + PREFETCH_BATCH_SIZE);
+        for (int64_t j = i; j < batch_end; ++j) {
+          __builtin_prefetch((&hash_table.buckets_->at(hist.h2_->at(j).hash_value_ & mask)), 1 /* w */, 3 /* high */);
+        }
+        for (int64_t j = i; j < batch_end; ++j) {
+          HistItem &hist_item = hist.h2_->at(j);
+          hash_table.atomic_set(hist_item.hash_value_, hist_item.store_row_, used_buckets, collisions);
+        }
+      }
+    }
+    LOG_TRACE("trace shared build by histogram", K(nth_row), K(range_cnt), K(start_range),
+      K(hash_table.nbuckets_), K(spec_.id_));
+  }
+  hist.reset();
+  return ret;
+}
+
 int ObHashJoinOp::HashJoinHistogram::init(
   ObIAllocator *alloc, int64_t row_count, int64_t bucket_cnt, bool enable_bloom_filter)
 {
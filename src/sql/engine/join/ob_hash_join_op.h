@@ -489,7 +489,7 @@ private:
 
     // lock-free hash table
     inline void atomic_set(const uint64_t hash_val, ObHashJoinStoredJoinRow *sr,
-      int64_t used_buckets, int64_t collisions)
+      int64_t &used_buckets, int64_t &collisions)
     {
       HTBucket new_bucket;
       new_bucket.hash_value_ = hash_val;
@@ -872,6 +872,23 @@ private:
   int prepare_hash_table();
   void trace_hash_table_collision(int64_t row_cnt);
   int build_hash_table_for_recursive();
+  // Shared hash table build: each worker radix orders its rows by bucket range of the
+  // shared bucket array with a HashJoinHistogram, then CAS inserts range by range,
+  // different workers starting from different ranges.
+  bool need_shared_build_hist(const int64_t row_count) const;
+  int init_shared_build_hist(HashJoinHistogram &hist, const int64_t row_count);
+  int add_shared_build_hist_rows(HashJoinHistogram &hist,
+                                 const ObHashJoinStoredJoinRow **stored_rows,
+                                 const int64_t read_size,
+                                 int64_t &nth_row);
+  int insert_shared_build_hist(HashJoinHistogram &hist,
+                               const int64_t nth_row,
+                               int64_t &used_buckets,
+                               int64_t &collisions);
+  OB_INLINE int64_t get_shared_build_range_idx(const uint64_t hash_value) const
+  {
+    return (hash_value & (cur_hash_table_->nbuckets_ - 1)) >> shared_build_range_shift_;
+  }
   int split_partition_and_build_hash_table(int64_t &num_left_rows);
   int recursive_process(bool &need_not_read_right);
   int adaptive_process(bool &need_not_read_right);
@@ -1105,6 +1122,9 @@ private:
   static const int64_t DEFAULT_MEM_LIMIT = 100 * 1024 * 1024;
 
   static const int64_t CACHE_AWARE_PART_CNT = 128;
+  // min rows of one worker to order rows by bucket range before shared hash table insert
+  static const int64_t SHARED_BUILD_HIST_MIN_ROW_CNT = 100000;
+  static const int64_t SHARED_BUILD_MAX_RANGE_CNT = 1024;
   static const int64_t BATCH_RESULT_SIZE = 512;
   static const int64_t INIT_LTB_SIZE = 64;
   static const int64_t MIN_PART_COUNT = 8;
@@ -1225,6 +1245,7 @@ private:
   HashJoinHistogram *cur_right_hist_;
   int64_t cur_probe_row_idx_;
   int64_t max_right_bucket_idx_;
+  int64_t shared_build_range_shift_;
 
   // statistics
   int64_t probe_cnt_;
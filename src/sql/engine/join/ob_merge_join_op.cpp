@@ -21,6 +21,8 @@ using namespace common;
 namespace sql
 {
 static const int64_t BATCH_MULTIPLE_TIMES = 10;
+// gallop over the smaller run only if enough rows remain in batch
+static const int64_t MIN_GALLOP_ROWS = 8;
 OB_SERIALIZE_MEMBER((ObMergeJoinSpec, ObJoinSpec), equal_cond_infos_,
                     merge_directions_, is_left_unique_,
                     left_child_fetcher_all_exprs_,
@@ -1085,7 +1087,11 @@ int ObMergeJoinOp::ChildBatchFetcher::get_next_small_group(int64_t &cmp_res)
   JoinRowList row_list(datum_store_.get_row_cnt());
   ObEvalCtx::BatchInfoScopeGuard guard(merge_join_op_.eval_ctx_);
   while (OB_SUCC(ret) && !all_batch_finished && !greater_found && !enough_datums) {
-    if (need_store_unmatch && OB_LIKELY(cur_idx_ < brs_.size_)) {
+    // unmatched rows are neither stored nor output, skip the smaller run of current
+    // batch in O(log n) compares instead of one compare per row.
+    if (!need_store_unmatch && OB_FAIL(gallop_smaller_rows<is_left>())) {
+      LOG_WARN("gallop smaller rows failed", K(ret));
+    } else if (need_store_unmatch && OB_LIKELY(cur_idx_ < brs_.size_)) {
       ObRADatumStore::StoredRow *stored_row = NULL;
       guard.set_batch_idx(cur_idx_);
       guard.set_batch_size(brs_.size_);
@@ -1126,6 +1132,55 @@ int ObMergeJoinOp::ChildBatchFetcher::get_next_small_group(int64_t &cmp_res)
   return ret;
 }
 
+template<bool is_left>
+int ObMergeJoinOp::ChildBatchFetcher::gallop_smaller_rows()
+{
+  int ret = OB_SUCCESS;
+  // row at cur_idx_ is known to be smaller than the other side's current row
+  const int64_t other_idx = is_left ? merge_join_op_.right_brs_fetcher_.cur_idx_
+                                    : merge_join_op_.left_brs_fetcher_.cur_idx_;
+  if (cur_idx_ + MIN_GALLOP_ROWS > brs_.size_ || OB_ISNULL(brs_.skip_)
+      || !brs_.skip_->is_all_false(brs_.size_)) {
+    // short run or skipped rows in batch, iterate row by row
+  } else {
+    int64_t low = cur_idx_; // last known smaller row
+    int64_t high = brs_.size_; // first known not smaller row, or end of batch
+    int64_t step = 1;
+    int64_t cmp_res = 0;
+    bool stop = false;
+    while (OB_SUCC(ret) && !stop && low + step < high) {
+      const int64_t idx = low + step;
+      if (OB_FAIL(merge_join_op_.calc_equal_conds_with_batch_idx(is_left ? idx : other_idx,
+                                                                 is_left ? other_idx : idx,
+                                                                 cmp_res))) {
+        LOG_WARN("calc equal conds with batch index failed", K(ret));
+      } else if (is_left ? cmp_res < 0 : cmp_res > 0) {
+        low = idx;
+        step <<= 1;
+      } else {
+        high = idx;
+        stop = true;
+      }
+    }
+    while (OB_SUCC(ret) && high - low > 1) {
+      const int64_t idx = low + (high - low) / 2;
+      if (OB_FAIL(merge_join_op_.calc_equal_conds_with_batch_idx(is_left ? idx : other_idx,
+                                                                 is_left ? other_idx : idx,
+                                                                 cmp_res))) {
+        LOG_WARN("calc equal conds with batch index failed", K(ret));
+      } else if (is_left ? cmp_res < 0 : cmp_res > 0) {
+        low = idx;
+      } else {
+        high = idx;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      cur_idx_ = low;
+    }
+  }
+  return ret;
+}
+
 template<bool is_left>
 int ObMergeJoinOp::ChildBatchFetcher::get_next_equal_group(JoinRowList &row_list,
                                                     const ObRADatumStore::StoredRow *stored_row,
@@ -1196,11 +1251,18 @@ int ObMergeJoinOp::ChildBatchFetcher::get_list_row(int64_t idx, ObRADatumStore::
 
 // calc equal conds with specified left_fechter batch_idx and right_fechter batch_idx
 int ObMergeJoinOp::calc_equal_conds_with_batch_idx(int64_t &cmp_res)
+{
+  return calc_equal_conds_with_batch_idx(left_brs_fetcher_.cur_idx_,
+                                         right_brs_fetcher_.cur_idx_,
+                                         cmp_res);
+}
+
+int ObMergeJoinOp::calc_equal_conds_with_batch_idx(const int64_t l_table_batch_idx,
+                                                   const int64_t r_table_batch_idx,
+                                                   int64_t &cmp_res)
 {
   int ret = OB_SUCCESS;
   cmp_res = 0;
-  int64_t l_table_batch_idx = left_brs_fetcher_.cur_idx_;
-  int64_t r_table_batch_idx = right_brs_fetcher_.cur_idx_;
   for (int64_t i = 0;
        OB_SUCC(ret) && 0 == cmp_res && i < MY_SPEC.equal_cond_infos_.count();
        i++) {
@@ -222,6 +222,10 @@ private:
              const ExprFixedArray *all_exprs);
     template<bool need_store_unmatch, bool is_left>
     int get_next_small_group(int64_t &cmp_res);
+    // move cur_idx_ to the last row of current batch which is still smaller than the
+    // other side's current row, by exponential and binary search.
+    template<bool is_left>
+    int gallop_smaller_rows();
     template<bool is_left>
     int get_next_equal_group(JoinRowList &row_list,
                              const ObRADatumStore::StoredRow *stored_row,
@@ -442,6 +446,9 @@ private:
     }
   }
   int calc_equal_conds_with_batch_idx(int64_t &cmp_res);
+  int calc_equal_conds_with_batch_idx(const int64_t l_table_batch_idx,
+                                      const int64_t r_table_batch_idx,
+                                      int64_t &cmp_res);
   template<bool is_left_table_stored_row>
   int calc_equal_conds_with_stored_row(const ObRADatumStore::StoredRow *stored_row,
                                        int64_t batch_idx, int64_t &cmp_res);
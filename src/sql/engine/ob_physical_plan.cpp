@@ -33,6 +33,8 @@
 #include "share/ob_truncated_string.h"
 #include "sql/spm/ob_spm_evolution_plan.h"
 #include "sql/engine/ob_exec_feedback_info.h"
+#include "sql/plan_cache/ob_plan_cache.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -1326,6 +1328,70 @@ int ObPhysicalPlan::set_feedback_info(ObExecContext &ctx)
       LOG_WARN("failed to compress logical plan", K(ret));
     } else if (OB_FAIL(set_logical_plan(new_logical_plan))) {
       LOG_WARN("failed to set logical plan", K(ret));
+    } else {
+      // cardinality feedback is best effort, never fail the query for it
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = check_card_feedback(ctx, plan_items))) {
+        LOG_WARN("failed to check card feedback", K(tmp_ret));
+      }
+    }
+  }
+  return ret;
+}
+
+// 首次执行时如果算子的实际行数和估行相差超过_optimizer_cardinality_feedback_ratio倍,
+// 让计划过期, 并记录该sql在下次硬解析时使用动态采样来修正估行.
+// 每个sql只反馈一次, 避免重新生成的计划仍然估不准时反复淘汰.
+int ObPhysicalPlan::check_card_feedback(ObExecContext &ctx,
+                                        const ObIArray<ObSqlPlanItem*> &plan_items)
+{
+  int ret = OB_SUCCESS;
+  ObSQLSessionInfo *session = ctx.get_my_session();
+  ObPlanCache *plan_cache = NULL;
+  double feedback_ratio = 0;
+  if (OB_ISNULL(session)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null session", K(ret));
+  } else if (stat_.sql_id_.empty() || is_expired() ||
+             OB_ISNULL(plan_cache = session->get_plan_cache())) {
+    // not cached plan
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session->get_effective_tenant_id()));
+    if (tenant_config.is_valid()) {
+      feedback_ratio = tenant_config->_optimizer_cardinality_feedback_ratio;
+    }
+  }
+  if (OB_SUCC(ret) && feedback_ratio > 1 && !plan_cache->is_card_feedback_sql(stat_.sql_id_)) {
+    bool has_rescan_op = false;
+    const ObSqlPlanItem *bad_item = NULL;
+    for (int64_t i = 0; !has_rescan_op && i < plan_items.count(); ++i) {
+      const ObSqlPlanItem *plan_item = plan_items.at(i);
+      if (OB_ISNULL(plan_item) || OB_ISNULL(plan_item->operation_)) {
+        // skip
+      } else if (ObString(plan_item->operation_len_, plan_item->operation_).prefix_match("NESTED-LOOP") ||
+                 ObString(plan_item->operation_len_, plan_item->operation_).prefix_match("SUBPLAN FILTER")) {
+        // real rows of the rescanned children are accumulated across rescans,
+        // can't be compared with the estimation
+        has_rescan_op = true;
+      } else if (NULL == bad_item) {
+        const int64_t est_rows = MAX(plan_item->cardinality_, 1);
+        const int64_t real_rows = MAX(plan_item->real_cardinality_, 1);
+        if (MAX(est_rows, real_rows) >= CARD_FEEDBACK_ROW_THRESHOLD &&
+            static_cast<double>(MAX(est_rows, real_rows)) / MIN(est_rows, real_rows)
+              >= feedback_ratio) {
+          bad_item = plan_item;
+        }
+      }
+    }
+    if (has_rescan_op || NULL == bad_item) {
+      // do nothing
+    } else if (OB_FAIL(plan_cache->add_card_feedback_sql(stat_.sql_id_))) {
+      LOG_WARN("failed to add card feedback sql", K(ret));
+    } else {
+      set_is_expired(true);
+      LOG_INFO("plan is expired due to bad cardinality estimation", K(stat_.sql_id_),
+               K(bad_item->id_), K(bad_item->cardinality_), K(bad_item->real_cardinality_),
+               K(feedback_ratio));
     }
   }
   return ret;
@@ -97,6 +97,7 @@ public:
   static const int64_t SLOW_QUERY_SAMPLE_SIZE = 20; // smaller than ObPlanStat::MAX_SCAN_STAT_SIZE
   static const int64_t TABLE_ROW_CHANGE_THRESHOLD = 2;
   static const int64_t EXPIRED_PLAN_TABLE_ROW_THRESHOLD = 100;
+  static const int64_t CARD_FEEDBACK_ROW_THRESHOLD = 1000;
   OB_UNIS_VERSION(1);
 public:
   explicit ObPhysicalPlan(lib::MemoryContext &mem_context = CURRENT_CONTEXT);
@@ -480,6 +481,7 @@ public:
   inline ObLogicalPlanRawData& get_logical_plan() { return logical_plan_; }
   inline const ObLogicalPlanRawData& get_logical_plan()const { return logical_plan_; }
   int set_feedback_info(ObExecContext &ctx);
+  int check_card_feedback(ObExecContext &ctx, const ObIArray<ObSqlPlanItem*> &plan_items);
 
   void set_enable_px_fast_reclaim(bool value) { is_enable_px_fast_reclaim_ = value; }
   bool is_enable_px_fast_reclaim() const { return is_enable_px_fast_reclaim_; }
@@ -149,6 +149,8 @@ void ObPxTransmitOp::destroy()
   px_row_allocator_.reset();
   ch_blocks_.reset();
   blk_bufs_.reset();
+  slice_selector_.reset();
+  slice_row_offsets_.reset();
   task_channels_.reset();
   dfc_.destroy();
   loop_.reset();
@@ -702,16 +704,9 @@ int ObPxTransmitOp::send_rows_in_batch(ObSliceIdxCalc &slice_calc)
                                1); // low temporal locality
           }
         }
-        for (int64_t i = 0; OB_SUCC(ret) && i < brs_.size_; i++) {
-          if (brs_.skip_->at(i)) {
-            continue;
-          }
-          batch_info_guard.set_batch_idx(i);
-          row_count += 1;
-          metric_.count();
-          if (OB_FAIL(send_row(indexes[i], send_row_time_recorder, tablet_id.get_int()))) {
-            LOG_WARN("fail emit row to interm result", K(ret), K(slice_idx_array));
-          }
+        if (OB_FAIL(send_rows_by_slice(indexes, batch_info_guard,
+                                       send_row_time_recorder, row_count))) {
+          LOG_WARN("fail emit rows to interm result", K(ret));
         }
       }
     }
@@ -746,6 +741,85 @@ int ObPxTransmitOp::send_rows_in_batch(ObSliceIdxCalc &slice_calc)
   return ret;
 }
 
+// Group rows of current batch by slice index, so that rows of the same channel are
+// appended to the channel block buffer column by column.
+int ObPxTransmitOp::send_rows_by_slice(const int64_t *indexes,
+                                       ObEvalCtx::BatchInfoScopeGuard &batch_info_guard,
+                                       int64_t &time_recorder,
+                                       int64_t &row_count)
+{
+  int ret = OB_SUCCESS;
+  const int64_t ch_cnt = ch_blocks_.count();
+  int64_t grouped_cnt = 0;
+  if (OB_FAIL(try_wait_channel())) {
+    LOG_WARN("failed to wait channel init", K(ret));
+  } else if (slice_selector_.count() < 2 * brs_.size_
+             && OB_FAIL(slice_selector_.prepare_allocate(2 * brs_.size_))) {
+    LOG_WARN("prepare allocate selector failed", K(ret), K(brs_.size_));
+  } else if (slice_row_offsets_.count() < ch_cnt + 1
+             && OB_FAIL(slice_row_offsets_.prepare_allocate(ch_cnt + 1))) {
+    LOG_WARN("prepare allocate slice offsets failed", K(ret), K(ch_cnt));
+  } else {
+    // first half of selector holds the grouped rows in batch order, second half
+    // holds them sorted by slice index
+    uint16_t *grouped = &slice_selector_.at(0);
+    uint16_t *selector = grouped + brs_.size_;
+    int64_t *offsets = &slice_row_offsets_.at(0);
+    MEMSET(offsets, 0, sizeof(*offsets) * (ch_cnt + 1));
+    for (int64_t i = 0; OB_SUCC(ret) && i < brs_.size_; i++) {
+      if (brs_.skip_->at(i)) {
+        continue;
+      }
+      row_count += 1;
+      metric_.count();
+      if (indexes[i] < 0 || !blk_bufs_.at(indexes[i]).is_inited()) {
+        // drop row or channel without block buffer, send one by one
+        batch_info_guard.set_batch_idx(i);
+        if (OB_FAIL(send_row(indexes[i], time_recorder, 0))) {
+          LOG_WARN("fail emit row to interm result", K(ret), K(indexes[i]));
+        }
+      } else {
+        offsets[indexes[i] + 1] += 1;
+        grouped[grouped_cnt++] = static_cast<uint16_t>(i);
+      }
+    }
+    if (OB_SUCC(ret) && grouped_cnt > 0) {
+      for (int64_t i = 0; i < ch_cnt; i++) {
+        offsets[i + 1] += offsets[i];
+      }
+      for (int64_t i = 0; i < grouped_cnt; i++) {
+        const uint16_t batch_idx = grouped[i];
+        selector[offsets[indexes[batch_idx]]++] = batch_idx;
+      }
+      // offsets[i] is the end of slice i now
+      int64_t start = 0;
+      for (int64_t slice_idx = 0; OB_SUCC(ret) && slice_idx < ch_cnt; slice_idx++) {
+        const int64_t end = offsets[slice_idx];
+        while (OB_SUCC(ret) && start < end) {
+          ObChunkDatumStore::BlockBufferWrap &blk_buf = blk_bufs_.at(slice_idx);
+          int64_t appended = 0;
+          if (blk_buf.is_inited()
+              && OB_FAIL(blk_buf.append_batch(get_spec().output_, eval_ctx_,
+                                              selector + start, end - start, appended))) {
+            LOG_WARN("fail to append batch", K(ret), K(slice_idx));
+          } else if (FALSE_IT(start += appended)) {
+          } else if (start < end) {
+            // block buffer is full or not inited, switch block by sending the row normally
+            batch_info_guard.set_batch_idx(selector[start]);
+            if (OB_FAIL(send_row(slice_idx, time_recorder, 0))) {
+              LOG_WARN("fail emit row to interm result", K(ret), K(slice_idx));
+            } else {
+              start += 1;
+            }
+          }
+        }
+        start = end;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObPxTransmitOp::send_eof_row()
 {
   int ret = OB_SUCCESS;
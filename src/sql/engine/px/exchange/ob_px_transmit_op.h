@@ -148,6 +148,10 @@ private:
   int send_row(int64_t slice_idx,
                int64_t &time_recorder,
                int64_t tablet_id);
+  int send_rows_by_slice(const int64_t *indexes,
+                         ObEvalCtx::BatchInfoScopeGuard &batch_info_guard,
+                         int64_t &time_recorder,
+                         int64_t &row_count);
   int send_eof_row();
   int broadcast_eof_row();
   int next_row();
@@ -172,6 +176,9 @@ private:
 protected:
   ObArray<ObChunkDatumStore::Block *> ch_blocks_;
   ObArray<ObChunkDatumStore::BlockBufferWrap> blk_bufs_;
+  // rows of current batch grouped by slice index, for vectorized send
+  ObArray<uint16_t> slice_selector_;
+  ObArray<int64_t> slice_row_offsets_;
   common::ObArray<dtl::ObDtlChannel*> task_channels_;
   common::ObArenaAllocator px_row_allocator_;
   ObPxTaskChSet task_ch_set_;
@@ -174,6 +174,9 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
   pwj_rescan_task_infos_(),
   filter_count_(0),
   total_count_(0),
+  granule_start_time_(0),
+  max_granule_time_(0),
+  total_granule_time_(0),
   rf_msg_(NULL),
   rf_key_(),
   tablet2part_id_map_(),
@@ -182,6 +185,8 @@ ObGranuleIteratorOp::ObGranuleIteratorOp(ObExecContext &exec_ctx, const ObOpSpec
 {
   op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::FILTERED_GRANULE_COUNT;
   op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::TOTAL_GRANULE_COUNT;
+  op_monitor_info_.otherstat_3_id_ = ObSqlMonitorStatIds::MAX_GRANULE_TIME;
+  op_monitor_info_.otherstat_4_id_ = ObSqlMonitorStatIds::TOTAL_GRANULE_TIME;
 }
 
 void ObGranuleIteratorOp::destroy()
@@ -312,6 +317,8 @@ int ObGranuleIteratorOp::rescan()
 {
   int ret = ObOperator::inner_rescan();
   CK(NULL != pump_);
+  // the granule in progress is abandoned, the gap until the next scan is not granule time
+  granule_start_time_ = 0;
   if (OB_FAIL(ret)) {
   } else if (!ObGranuleUtil::is_partition_task_mode(MY_SPEC.gi_attri_flag_) &&
       ObGranuleUtil::partition_filter(MY_SPEC.gi_attri_flag_)) {
@@ -329,7 +336,8 @@ int ObGranuleIteratorOp::rescan()
     all_task_fetched_ = false;
     pwj_rescan_task_infos_.reset();
     pruning_partition_ids_.reset();
-    while (OB_SUCC(get_next_granule_task())) {}
+    // tasks are only collected for rescan here, they are timed when replayed
+    while (OB_SUCC(get_next_granule_task(false /* prepare */, false /* timing */))) {}
     if (ret != OB_ITER_END) {
       LOG_WARN("failed to get all granule task", K(ret));
     } else {
@@ -345,7 +353,7 @@ int ObGranuleIteratorOp::rescan()
       // NJ call rescan before iterator rows, need to nothing for the first scan.
     } else if (GI_PREPARED == state_) {
       // At the open-stage we get a granule task, and now, we fetch all the granule task.
-      while(OB_SUCC(get_next_granule_task())) {}
+      while(OB_SUCC(get_next_granule_task(false /* prepare */, false /* timing */))) {}
       if (ret != OB_ITER_END) {
         LOG_WARN("failed to get all granule task", K(ret));
       } else {
@@ -471,6 +479,8 @@ int ObGranuleIteratorOp::try_get_rows(const int64_t max_row_cnt)
         } else {
           op_monitor_info_.otherstat_1_value_ = filter_count_;
           op_monitor_info_.otherstat_2_value_ = total_count_;
+          op_monitor_info_.otherstat_3_value_ = max_granule_time_;
+          op_monitor_info_.otherstat_4_value_ = total_granule_time_;
         }
       }
     }
@@ -531,10 +541,18 @@ int ObGranuleIteratorOp::try_get_rows(const int64_t max_row_cnt)
   return ret;
 }
 
-int ObGranuleIteratorOp::get_next_granule_task(bool prepare /* = false */)
+int ObGranuleIteratorOp::get_next_granule_task(bool prepare /* = false */,
+                                               bool timing /* = true */)
 {
   int ret = OB_SUCCESS;
   bool partition_pruning = true;
+  const int64_t cur_time = timing ? ObTimeUtility::fast_current_time() : 0;
+  if (timing && 0 != granule_start_time_) {
+    const int64_t granule_time = cur_time - granule_start_time_;
+    max_granule_time_ = std::max(max_granule_time_, granule_time);
+    total_granule_time_ += granule_time;
+    granule_start_time_ = 0;
+  }
   while (OB_SUCC(ret) && partition_pruning) {
     if (OB_FAIL(do_get_next_granule_task(partition_pruning))) {
       if (ret != OB_ITER_END) {
@@ -551,6 +569,7 @@ int ObGranuleIteratorOp::get_next_granule_task(bool prepare /* = false */)
       LOG_WARN("fail to rescan gi' child", K(ret));
     } else {
       state_ = GI_TABLE_SCAN;
+      granule_start_time_ = cur_time;
     }
   }
   return ret;
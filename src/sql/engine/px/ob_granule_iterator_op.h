@@ -161,7 +161,8 @@ public:
 
   virtual OperatorOpenOrder get_operator_open_order() const override
   { return OPEN_SELF_FIRST; }
-  int get_next_granule_task(bool prepare = false);
+  // @timing: false when tasks are fetched in bulk without being scanned, e.g. in rescan
+  int get_next_granule_task(bool prepare = false, bool timing = true);
 private:
   int parameters_init();
   // 非full partition wise获得task的方式
@@ -239,6 +240,10 @@ private:
    //for partition pruning
   int64_t filter_count_; // filtered part count when part pruning activated
   int64_t total_count_; // total partition count or block count processed, rescan included
+  // per granule timing, a granule is timed from being fetched to fetching the next one
+  int64_t granule_start_time_;
+  int64_t max_granule_time_;
+  int64_t total_granule_time_;
   ObP2PDatahubMsgBase *rf_msg_;
   ObP2PDhKey rf_key_;
   ObPxTablet2PartIdMap tablet2part_id_map_;
@@ -19,6 +19,7 @@
 #include "observer/omt/ob_tenant.h"
 #include "ob_px_target_mgr.h"
 #include "ob_px_util.h"
+#include "sql/engine/ob_tenant_sql_memory_manager.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::sql;
@@ -57,6 +58,41 @@ int ObPxAdmission::get_parallel_session_target(ObSQLSessionInfo &session,
   return ret;
 }
 
+// 线程之外，还要看 SQL 工作区内存：
+// 工作区 hold 内存超过 max workarea size 的一定比例时，若已有其它 px 查询在执行，
+// 则推迟准入，等它们结束释放内存后再申请线程，避免并发的大查询一起落盘。
+// 没有 px 查询在执行时总是放行，保证系统空闲时请求可以执行
+int ObPxAdmission::check_workarea_memory(uint64_t tenant_id, bool &is_mem_enough)
+{
+  int ret = OB_SUCCESS;
+  is_mem_enough = true;
+  int64_t limit_pct = 0;
+  int64_t parallel_session_count = 0;
+  ObTenantSqlMemoryManager *sql_mem_mgr = MTL(ObTenantSqlMemoryManager*);
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id));
+  if (!tenant_config.is_valid()
+      || 0 == (limit_pct = tenant_config->_px_admission_workarea_limit_percentage)) {
+    // no limit
+  } else if (OB_ISNULL(sql_mem_mgr)
+             || !sql_mem_mgr->enable_auto_memory_mgr()
+             || sql_mem_mgr->get_max_workarea_size() <= 0) {
+    // work area is not managed automatically, nothing to refer to
+  } else if (OB_FAIL(OB_PX_TARGET_MGR.get_parallel_session_count(tenant_id,
+                                                                 parallel_session_count))) {
+    LOG_WARN("get parallel session count failed", K(ret), K(tenant_id));
+  } else if (parallel_session_count > 0) {
+    is_mem_enough = sql_mem_mgr->get_workarea_hold_size() * 100
+                    < sql_mem_mgr->get_max_workarea_size() * limit_pct;
+    if (!is_mem_enough) {
+      LOG_TRACE("sql work area is short of memory, delay px admission", K(tenant_id),
+                K(limit_pct), K(parallel_session_count),
+                K(sql_mem_mgr->get_workarea_hold_size()),
+                K(sql_mem_mgr->get_max_workarea_size()));
+    }
+  }
+  return ret;
+}
+
 // 如果当前剩余线程数能满足 req_cnt，则分配线程给请求
 // 但考虑到系统空闲时，要允许第一个请求执行，需要处理下面的特殊情况：
 //   如果 请求的线程数 req_cnt 大于 limit，并且当前没有其它 px 请求（used = 0）
@@ -75,9 +111,18 @@ int64_t ObPxAdmission::admit(ObSQLSessionInfo &session, ObExecContext &exec_ctx,
   int64_t left_time_us = wait_time_us;
   int64_t start_time_us = ObClockGenerator::getClock();
   bool need_retry = false;
+  bool is_mem_enough = true;
   do {
     if (OB_FAIL(THIS_WORKER.check_status())) {
       LOG_WARN("fail check query status", K(ret));
+    } else if (OB_FAIL(check_workarea_memory(tenant_id, is_mem_enough))) {
+      LOG_WARN("check sql work area memory failed", K(ret), K(tenant_id));
+    } else if (!is_mem_enough) {
+      // wait for running px queries to release resource, same as short of threads
+      admit_cnt = 0;
+      if (OB_FAIL(OB_PX_TARGET_MGR.wait_target(tenant_id, wait_time_us))) {
+        LOG_WARN("wait target failed", K(ret), K(tenant_id));
+      }
     } else if (OB_FAIL(OB_PX_TARGET_MGR.apply_target(tenant_id, worker_map, wait_time_us, session_target, req_cnt, admit_cnt, admission_version))) {
       LOG_WARN("apply target failed", K(ret), K(tenant_id), K(req_cnt));
     } else if (0 != admit_cnt) {
@@ -88,9 +133,9 @@ int64_t ObPxAdmission::admit(ObSQLSessionInfo &session, ObExecContext &exec_ctx,
     if (OB_SUCC(ret) && 0 == admit_cnt && left_time_us > 0) {
       if (!need_retry) {
         // only print once
-        LOG_INFO("Not enough PX thread to execute query."
+        LOG_INFO("Not enough PX thread or sql work area memory to execute query."
                  "should wait and re-acquire thread resource from target queue",
-                 K(req_cnt), K(left_time_us));
+                 K(req_cnt), K(left_time_us), K(is_mem_enough));
         // fake one retry record, not really a query retry
         session.get_retry_info_for_update().set_last_query_retry_err(OB_ERR_INSUFFICIENT_PX_WORKER);
       }
@@ -55,6 +55,7 @@ private:
   static int get_parallel_session_target(sql::ObSQLSessionInfo &session,
                                          int64_t minimal_session_target,
                                          int64_t &session_target);
+  static int check_workarea_memory(uint64_t tenant_id, bool &is_mem_enough);
   /* variables */
   DISALLOW_COPY_AND_ASSIGN(ObPxAdmission);
 };
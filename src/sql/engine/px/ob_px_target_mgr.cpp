@@ -369,6 +369,15 @@ int ObPxTargetMgr::release_target(uint64_t tenant_id, hash::ObHashMap<ObAddr, in
   return ret;
 }
 
+int ObPxTargetMgr::wait_target(uint64_t tenant_id, int64_t wait_time_us)
+{
+  int ret = OB_SUCCESS;
+  GET_TARGET_MONITOR(tenant_id, {
+    target_monitor->wait_target(wait_time_us);
+  });
+  return ret;
+}
+
 int ObPxTargetMgr::get_all_tenant(common::ObSEArray<uint64_t, 4> &tenant_array)
 {
   int ret = OB_SUCCESS;
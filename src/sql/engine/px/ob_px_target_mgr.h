@@ -127,6 +127,7 @@ public:
                    int64_t wait_time_us, int64_t session_target, int64_t req_cnt,
                    int64_t &admit_count, uint64_t &admit_version);
   int release_target(uint64_t tenant_id, hash::ObHashMap<ObAddr, int64_t> &worker_map, uint64_t admit_version);
+  int wait_target(uint64_t tenant_id, int64_t wait_time_us);
 
   // for virtual_table iter
   int get_all_tenant(common::ObSEArray<uint64_t, 4> &tenant_array);
@@ -510,6 +510,14 @@ int ObPxTenantTargetMonitor::release_target(hash::ObHashMap<ObAddr, int64_t> &wo
   return ret;
 }
 
+void ObPxTenantTargetMonitor::wait_target(int64_t wait_time_us)
+{
+  int64_t wait_us = min(wait_time_us, 1000000L);
+  if (wait_us > 0) {
+    target_cond_.wait(wait_us); // sleep at most 1sec, in order to check interrput
+  }
+}
+
 int ObPxTenantTargetMonitor::get_all_target_info(common::ObIArray<ObPxTargetInfo> &target_info_array)
 {
   int ret = OB_SUCCESS;
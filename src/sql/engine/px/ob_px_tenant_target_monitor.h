@@ -141,6 +141,8 @@ public:
                    int64_t wait_time_us, int64_t session_target, int64_t req_cnt,
                    int64_t &admit_count, uint64_t &admit_version);
   int release_target(hash::ObHashMap<ObAddr, int64_t> &worker_map, uint64_t version);
+  // wait until any admitted query releases its resource, or timeout
+  void wait_target(int64_t wait_time_us);
 
   // for virtual_table iter
   int get_all_target_info(common::ObIArray<ObPxTargetInfo> &target_info_array);
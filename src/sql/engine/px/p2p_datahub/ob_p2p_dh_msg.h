@@ -66,6 +66,12 @@ public:
       const int64_t batch_size,
       ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx)
       { return OB_SUCCESS; }
+  // check whether any value of the only filter column in [min, max] may pass the filter
+  virtual int might_contain_range(const ObDatum &min,
+      const ObDatum &max,
+      ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx,
+      bool &is_match)
+      { is_match = true; return OB_SUCCESS; }
   virtual int insert_by_row(
     const common::ObIArray<ObExpr *> &expr_array,
     const common::ObHashFuncs &hash_funcs_,
@@ -1114,6 +1114,36 @@ int ObRFRangeFilterMsg::might_contain(const ObExpr &expr,
   return ret;
 }
 
+int ObRFRangeFilterMsg::might_contain_range(const ObDatum &min,
+    const ObDatum &max,
+    ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx,
+    bool &is_match)
+{
+  int ret = OB_SUCCESS;
+  int cmp_min = 0;
+  int cmp_max = 0;
+  is_match = true;
+  if (OB_UNLIKELY(is_empty_)) {
+    is_match = false;
+  } else if (1 != lower_bounds_.count() || 1 != filter_ctx.cmp_funcs_.count()
+             || lower_bounds_.at(0).is_null() || upper_bounds_.at(0).is_null()) {
+    // null bound may match null value with null safe equal
+  } else {
+    ObCmpFunc cmp_func;
+    cmp_func.cmp_func_ = filter_ctx.cmp_funcs_.at(0).cmp_func_;
+    if (OB_FAIL(cmp_func.cmp_func_(max, lower_bounds_.at(0), cmp_min))) {
+      LOG_WARN("fail to compare value", K(ret));
+    } else if (cmp_min < 0) {
+      is_match = false;
+    } else if (OB_FAIL(cmp_func.cmp_func_(min, upper_bounds_.at(0), cmp_max))) {
+      LOG_WARN("fail to compare value", K(ret));
+    } else if (cmp_max > 0) {
+      is_match = false;
+    }
+  }
+  return ret;
+}
+
 int ObRFRangeFilterMsg::might_contain_batch(
     const ObExpr &expr,
     ObEvalCtx &ctx,
@@ -1463,6 +1493,41 @@ int ObRFInFilterMsg::reuse()
   return ret;
 }
 
+int ObRFInFilterMsg::might_contain_range(const ObDatum &min,
+    const ObDatum &max,
+    ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx,
+    bool &is_match)
+{
+  int ret = OB_SUCCESS;
+  is_match = true;
+  if (OB_UNLIKELY(!is_active_)) {
+  } else if (OB_UNLIKELY(is_empty_)) {
+    is_match = false;
+  } else if (1 != col_cnt_ || 1 != filter_ctx.cmp_funcs_.count()) {
+  } else {
+    ObCmpFunc cmp_func;
+    cmp_func.cmp_func_ = filter_ctx.cmp_funcs_.at(0).cmp_func_;
+    is_match = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !is_match && i < serial_rows_.count(); ++i) {
+      const ObDatum &val = serial_rows_.at(i)->at(0);
+      int cmp_min = 0;
+      int cmp_max = 0;
+      if (val.is_null()) {
+        // null value may match null with null safe equal
+        is_match = true;
+      } else if (OB_FAIL(cmp_func.cmp_func_(min, val, cmp_min))) {
+        LOG_WARN("fail to compare value", K(ret));
+      } else if (cmp_min > 0) {
+      } else if (OB_FAIL(cmp_func.cmp_func_(max, val, cmp_max))) {
+        LOG_WARN("fail to compare value", K(ret));
+      } else if (cmp_max >= 0) {
+        is_match = true;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObRFInFilterMsg::might_contain_batch(
     const ObExpr &expr,
     ObEvalCtx &ctx,
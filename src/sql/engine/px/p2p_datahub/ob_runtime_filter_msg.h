@@ -142,6 +142,10 @@ public:
       const ObBitVector &skip,
       const int64_t batch_size,
       ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx) override;
+  virtual int might_contain_range(const ObDatum &min,
+      const ObDatum &max,
+      ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx,
+      bool &is_match) override;
   virtual int insert_by_row(
     const common::ObIArray<ObExpr *> &expr_array,
     const common::ObHashFuncs &hash_funcs,
@@ -208,6 +212,10 @@ public:
       const ObBitVector &skip,
       const int64_t batch_size,
       ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx) override;
+  virtual int might_contain_range(const ObDatum &min,
+      const ObDatum &max,
+      ObExprJoinFilter::ObExprJoinFilterContext &filter_ctx,
+      bool &is_match) override;
   virtual int insert_by_row(
     const common::ObIArray<ObExpr *> &expr_array,
     const common::ObHashFuncs &hash_funcs,
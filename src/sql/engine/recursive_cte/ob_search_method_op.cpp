@@ -168,6 +168,37 @@ int ObSearchMethodOp::is_same_row(ObChunkDatumStore::StoredRow &row_1st,
   return ret;
 }
 
+int ObSearchMethodOp::calc_cycle_hash(const ObChunkDatumStore::StoredRow &row, uint64_t &hash_val)
+{
+  int ret = OB_SUCCESS;
+  const ObDatum *cells = row.cells();
+  hash_val = HASH_SEED;
+  if (OB_UNLIKELY(0 == row.cnt_) || OB_ISNULL(cells)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid row", K(ret), K(row));
+  } else if (cycle_by_columns_.empty()) {
+    for (int64_t i = 0; OB_SUCC(ret) && i < left_output_.count(); i++) {
+      if (OB_UNLIKELY(i >= row.cnt_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Column index out of range", K(ret), K(i), K(row.cnt_));
+      } else if (OB_FAIL(left_output_.at(i)->basic_funcs_->wy_hash_(cells[i], hash_val, hash_val))) {
+        LOG_WARN("failed to calc hash", K(ret), K(i));
+      }
+    }
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < cycle_by_columns_.count(); ++i) {
+      uint64_t index = cycle_by_columns_.at(i);
+      if (index >= row.cnt_) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Column index out of range", K(ret), K(index), K(row.cnt_));
+      } else if (OB_FAIL(left_output_.at(index)->basic_funcs_->wy_hash_(cells[index], hash_val, hash_val))) {
+        LOG_WARN("failed to calc hash", K(ret), K(index), K(i));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDepthFisrtSearchOp::init()
 {
   int ret = OB_SUCCESS;
@@ -390,16 +421,23 @@ int ObBreadthFisrtSearchOp::is_breadth_cycle_node(ObTreeNode &node)
   int ret = OB_SUCCESS;
   ObBFSTreeNode* tmp = current_parent_node_;
   ObChunkDatumStore::StoredRow* row = node.stored_row_;
-  if (OB_ISNULL(tmp) || OB_ISNULL(row)) {
+  uint64_t hash_val = 0;
+  if (OB_ISNULL(tmp) || OB_ISNULL(row) || OB_ISNULL(node.in_bstree_node_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("The last_bstnode and row an not be null", K(ret), KPC(row));
+  } else if (OB_FAIL(calc_cycle_hash(*row, hash_val))) {
+    LOG_WARN("Failed to calc cycle hash", K(ret), KPC(row));
   } else {
+    node.in_bstree_node_->hash_val_ = hash_val;
     // bst_root_ 的row_为空
     while(OB_SUCC(ret) && OB_NOT_NULL(tmp) && OB_NOT_NULL(tmp->stored_row_)) {
       ObChunkDatumStore::StoredRow* row_1st = row;
       ObChunkDatumStore::StoredRow* row_2nd = tmp->stored_row_;
       // 从扁鹊看，对cycle的检测占了层次查询绝大多数时间，特别慢。
-      if (OB_FAIL(is_same_row(*row_1st, *row_2nd, node.is_cycle_))) {
+      // 祖先节点的哈希值在其加入时已经计算，哈希值不同的行一定不同，跳过逐列比较。
+      if (tmp->hash_val_ != hash_val) {
+        tmp = tmp->parent_;
+      } else if (OB_FAIL(is_same_row(*row_1st, *row_2nd, node.is_cycle_))) {
         LOG_WARN("Failed to compare the two row", K(ret), KPC(row_1st), KPC(row_2nd));
       } else if (node.is_cycle_) {
         break;
@@ -31,15 +31,18 @@ public:
   typedef struct _BreadthFirstSearchTreeNode {
     _BreadthFirstSearchTreeNode() :
       child_num_(0),
+      hash_val_(0),
       stored_row_(nullptr),
       children_(nullptr),
       parent_(nullptr)
     {}
     int64_t child_num_;
+    // hash value of cycle detection columns, used to filter rows before comparing
+    uint64_t hash_val_;
     ObChunkDatumStore::StoredRow* stored_row_;
     struct _BreadthFirstSearchTreeNode** children_;
     struct _BreadthFirstSearchTreeNode* parent_;
-    TO_STRING_KV("row ", stored_row_, "child_num_", child_num_);
+    TO_STRING_KV("row ", stored_row_, "child_num_", child_num_, "hash_val_", hash_val_);
   } ObBFSTreeNode;
 
   typedef struct _TreeNode
@@ -199,6 +202,8 @@ public:
   // 使用行内容进行比较，若有一样的数据则认为此节点为环
   int is_same_row(ObChunkDatumStore::StoredRow &row_1st, ObChunkDatumStore::StoredRow &row_2nd,
                   bool &is_cycle);
+  // 计算环检测列的哈希值，与is_same_row使用相同的列
+  int calc_cycle_hash(const ObChunkDatumStore::StoredRow &row, uint64_t &hash_val);
   int64_t count() { return input_rows_.count(); }
   virtual uint64_t get_last_node_level() { return last_node_level_; }
   const static int64_t ROW_EXTRA_SIZE = 0;
@@ -187,7 +187,8 @@ int ObHashExceptOp::batch_process_right_vectorize(const int64_t batch_size)
       }
     } else if (OB_FAIL(hp_infras_.get_right_next_batch(MY_SPEC.set_exprs_,
                                                        batch_size,
-                                                       read_rows))) {
+                                                       read_rows,
+                                                       hash_values_for_batch_))) {
       LOG_WARN("failed to get next batch from dumped partition", K(ret), K(read_rows));
     } else {
       cur_exprs = &MY_SPEC.set_exprs_;
@@ -198,7 +199,8 @@ int ObHashExceptOp::batch_process_right_vectorize(const int64_t batch_size)
     } else if (OB_FAIL(hp_infras_.exists_batch(*cur_exprs, read_rows, 
                                                has_got_part_ ? brs_.skip_ : right_brs->skip_, 
                                                brs_.skip_, 
-                                               hash_values_for_batch_))) {
+                                               hash_values_for_batch_,
+                                               has_got_part_))) {
       LOG_WARN("failed to exists batch", K(ret));
     } else {
       //for except, do not need set skip vector in exists_batch, all rows are from hash table.
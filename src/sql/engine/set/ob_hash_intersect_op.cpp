@@ -218,7 +218,8 @@ int ObHashIntersectOp::inner_get_next_batch(const int64_t max_row_cnt)
       }
     } else if (OB_FAIL(hp_infras_.get_right_next_batch(MY_SPEC.set_exprs_,
                                                        batch_size,
-                                                       read_rows))) {
+                                                       read_rows,
+                                                       hash_values_for_batch_))) {
       if (OB_ITER_END != ret) {
         LOG_WARN("failed to get next batch", K(ret));
       }
@@ -254,7 +255,8 @@ int ObHashIntersectOp::inner_get_next_batch(const int64_t max_row_cnt)
     } else if (OB_FAIL(hp_infras_.exists_batch(*cur_exprs, read_rows, 
                                                has_got_part_ ? brs_.skip_ : right_brs->skip_, 
                                                brs_.skip_, 
-                                               hash_values_for_batch_))) {
+                                               hash_values_for_batch_,
+                                               has_got_part_))) {
       LOG_WARN("failed to exist batch", K(ret));
     } else {
       got_batch = true;
@@ -16,6 +16,7 @@
 #include "sql/engine/px/ob_px_util.h"
 #include "sql/engine/aggregate/ob_hash_groupby_op.h"
 #include "sql/engine/window_function/ob_window_function_op.h"
+#include "sql/engine/table/ob_table_scan_op.h"
 
 namespace oceanbase
 {
@@ -60,6 +61,7 @@ ObSortOp::ObSortOp(ObExecContext &ctx_, const ObOpSpec &spec, ObOpInput *input)
   : ObOperator(ctx_, spec, input),
   sort_impl_(op_monitor_info_),
   prefix_sort_impl_(op_monitor_info_),
+  topn_filter_(),
   read_func_(&ObSortOp::sort_impl_next),
   read_batch_func_(&ObSortOp::sort_impl_next_batch),
   sort_row_count_(0),
@@ -89,6 +91,7 @@ void ObSortOp::reset()
 {
   sort_impl_.reset();
   prefix_sort_impl_.reset();
+  topn_filter_.reset_boundary();
   read_func_ = &ObSortOp::sort_impl_next;
   read_batch_func_ = &ObSortOp::sort_impl_next_batch;
   sort_row_count_ = 0;
@@ -442,6 +445,39 @@ int ObSortOp::init_sort(int64_t tenant_id,
   sort_impl_.set_operator_type(MY_SPEC.type_);
   sort_impl_.set_operator_id(MY_SPEC.id_);
   sort_impl_.set_io_event_observer(&io_event_observer_);
+  if (OB_SUCC(ret) && INT64_MAX != topn_cnt && OB_FAIL(bind_topn_filter())) {
+    LOG_WARN("failed to bind topn filter", K(ret));
+  }
+  return ret;
+}
+
+int ObSortOp::bind_topn_filter()
+{
+  int ret = OB_SUCCESS;
+  ObOperator *scan_op = child_;
+  bool is_bound = false;
+  if (OB_NOT_NULL(scan_op) && PHY_GRANULE_ITERATOR == scan_op->get_spec().type_
+      && 1 == scan_op->get_child_cnt()) {
+    scan_op = scan_op->get_child();
+  }
+  if (OB_ISNULL(scan_op) || PHY_TABLE_SCAN != scan_op->get_spec().type_
+      || MY_SPEC.part_cnt_ > 0 || MY_SPEC.enable_encode_sortkey_opt_
+      || MY_SPEC.sort_collations_.empty() || MY_SPEC.sort_cmp_funs_.empty()) {
+    // only the first sort key of plain topn sort on a table scan can be pushed down
+  } else if (OB_UNLIKELY(MY_SPEC.sort_collations_.at(0).field_idx_ >= MY_SPEC.all_exprs_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sort field out of range", K(ret), K(MY_SPEC.sort_collations_.at(0)));
+  } else if (OB_FAIL(topn_filter_.init(MY_SPEC.all_exprs_.at(MY_SPEC.sort_collations_.at(0).field_idx_),
+                                       MY_SPEC.sort_cmp_funs_.at(0).cmp_func_,
+                                       MY_SPEC.sort_collations_.at(0).is_ascending_,
+                                       ctx_.get_allocator()))) {
+    LOG_WARN("failed to init topn filter", K(ret));
+  } else if (OB_FAIL(static_cast<ObTableScanOp *>(scan_op)->bind_topn_filter(topn_filter_, is_bound))) {
+    LOG_WARN("failed to bind topn filter to table scan", K(ret));
+  } else if (is_bound) {
+    sort_impl_.set_topn_filter(&topn_filter_);
+    LOG_DEBUG("bind topn filter to table scan", K_(topn_filter));
+  }
   return ret;
 }
 
@@ -18,6 +18,7 @@
 #include "common/object/ob_object.h"
 #include "share/datum/ob_datum_funcs.h"
 #include "sql/engine/sort/ob_sort_basic_info.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
 
 namespace oceanbase
 {
@@ -127,9 +128,12 @@ private:
                 int64_t row_count,
                 bool is_batch,
                 int64_t topn_cnt = INT64_MAX);
+  // push boundary of topn heap down to the table scan below
+  int bind_topn_filter();
 private:
   ObSortOpImpl sort_impl_;
   ObPrefixSortImpl prefix_sort_impl_;
+  ObPushdownTopNFilter topn_filter_;
   int (ObSortOp::*read_func_)();
   int (ObSortOp::*read_batch_func_)(const int64_t max_cnt);
   int64_t sort_row_count_;
@@ -15,6 +15,7 @@
 #include "ob_sort_op_impl.h"
 #include "sql/engine/ob_operator.h"
 #include "sql/engine/ob_tenant_sql_memory_manager.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
 #include "lib/container/ob_iarray.h"
 
@@ -543,6 +544,20 @@ bool ObSortOpImpl::Compare::operator()(const ObSortOpChunk *l, const ObSortOpChu
   return less;
 }
 
+int ObSortOpImpl::Compare::cmp(const ObSortOpChunk *l, const ObSortOpChunk *r, int64_t &cmp_ret)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(l) || OB_ISNULL(r)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(l), KP(r));
+  } else {
+    // the merge order of equal rows doesn't matter, save the reverse compare.
+    cmp_ret = (*this)(l->row_, r->row_) ? -1 : 1;
+    ret = ret_;
+  }
+  return ret;
+}
+
 bool ObSortOpImpl::Compare::operator()(
     ObChunkDatumStore::StoredRow **l,
     ObChunkDatumStore::StoredRow **r)
@@ -568,14 +583,14 @@ ObSortOpImpl::ObSortOpImpl(ObMonitorNode &op_monitor_info)
     got_first_row_(false), sorted_(false), enable_encode_sortkey_(false), mem_context_(NULL),
     mem_entify_guard_(mem_context_), tenant_id_(OB_INVALID_ID), sort_collations_(nullptr),
     sort_cmp_funs_(nullptr), eval_ctx_(nullptr), inmem_row_size_(0), mem_check_interval_mask_(1),
-    row_idx_(0), heap_iter_begin_(false), imms_heap_(NULL), ems_heap_(NULL),
+    row_idx_(0), heap_iter_begin_(false), imms_heap_(NULL), ems_loser_tree_(NULL),
     next_stored_row_func_(&ObSortOpImpl::array_next_stored_row),
     input_rows_(OB_INVALID_ID), input_width_(OB_INVALID_ID),
     profile_(ObSqlWorkAreaType::SORT_WORK_AREA), op_monitor_info_(op_monitor_info), sql_mem_processor_(profile_, op_monitor_info_),
     op_type_(PHY_INVALID), op_id_(UINT64_MAX), exec_ctx_(nullptr), stored_rows_(nullptr),
     io_event_observer_(nullptr), buckets_(NULL), max_bucket_cnt_(0), part_hash_nodes_(NULL),
     max_node_cnt_(0), part_cnt_(0), topn_cnt_(INT64_MAX), outputted_rows_cnt_(0),
-    is_fetch_with_ties_(false), topn_heap_(NULL), ties_array_pos_(0), ties_array_(),
+    is_fetch_with_ties_(false), topn_heap_(NULL), topn_filter_(NULL), ties_array_pos_(0), ties_array_(),
     last_ties_row_(NULL), rows_(NULL)
 {
 }
@@ -722,8 +737,8 @@ void ObSortOpImpl::reuse()
     imms_heap_->reset();
   }
   heap_iter_begin_ = false;
-  if (NULL != ems_heap_) {
-    ems_heap_->reset();
+  if (NULL != ems_loser_tree_) {
+    ems_loser_tree_->reuse();
   }
   if (NULL != topn_heap_) {
     for (int64_t i = 0; i < topn_heap_->count(); ++i) {
@@ -765,6 +780,7 @@ void ObSortOpImpl::reset()
   topn_cnt_ = INT64_MAX;
   outputted_rows_cnt_ = 0;
   is_fetch_with_ties_ = false;
+  topn_filter_ = NULL;
   rows_ = NULL;
   ties_array_pos_ = 0;
   if (0 != ties_array_.count()) {
@@ -780,10 +796,10 @@ void ObSortOpImpl::reset()
       mem_context_->get_malloc_allocator().free(imms_heap_);
       imms_heap_ = NULL;
     }
-    if (NULL != ems_heap_) {
-      ems_heap_->~EMSHeap();
-      mem_context_->get_malloc_allocator().free(ems_heap_);
-      ems_heap_ = NULL;
+    if (NULL != ems_loser_tree_) {
+      ems_loser_tree_->~EMSLoserTree();
+      mem_context_->get_malloc_allocator().free(ems_loser_tree_);
+      ems_loser_tree_ = NULL;
     }
     if (NULL != stored_rows_) {
       mem_context_->get_malloc_allocator().free(stored_rows_);
@@ -1516,14 +1532,14 @@ int ObSortOpImpl::build_ems_heap(int64_t &merge_ways)
       c = c->get_next();
     }
 
-    if (NULL == ems_heap_) {
-      if (OB_ISNULL(ems_heap_ = OB_NEWx(EMSHeap, (&mem_context_->get_malloc_allocator()),
-          comp_, &mem_context_->get_malloc_allocator()))) {
+    if (NULL == ems_loser_tree_) {
+      if (OB_ISNULL(ems_loser_tree_ = OB_NEWx(EMSLoserTree,
+          (&mem_context_->get_malloc_allocator()), comp_))) {
         ret = OB_ALLOCATE_MEMORY_FAILED;
         LOG_WARN("allocate memory failed", K(ret));
       }
     } else {
-      ems_heap_->reset();
+      ems_loser_tree_->reuse();
     }
     if (OB_SUCC(ret)) {
       merge_ways = get_memory_limit() / ObChunkDatumStore::BLOCK_SIZE;
@@ -1545,6 +1561,16 @@ int ObSortOpImpl::build_ems_heap(int64_t &merge_ways)
       LOG_TRACE("do merge sort ", K(first->level_), K(merge_ways), K(sort_chunks_.get_size()), K(get_memory_limit()), K(sql_mem_processor_.get_profile()));
     }
 
+    if (OB_FAIL(ret)) {
+      // do nothing
+    } else if (!ems_loser_tree_->is_inited()) {
+      if (OB_FAIL(ems_loser_tree_->init(merge_ways, mem_context_->get_malloc_allocator()))) {
+        LOG_WARN("init loser tree failed", K(ret), K(merge_ways));
+      }
+    } else if (OB_FAIL(ems_loser_tree_->open(merge_ways))) {
+      LOG_WARN("open loser tree failed", K(ret), K(merge_ways));
+    }
+
     if (OB_SUCC(ret)) {
       ObSortOpChunk *chunk = sort_chunks_.get_first();
       for (int64_t i = 0; i < merge_ways && OB_SUCC(ret); i++) {
@@ -1559,12 +1585,15 @@ int ObSortOpImpl::build_ems_heap(int64_t &merge_ways)
                 K(ret), KP(chunk->row_));
           }
           LOG_WARN("get next row failed", K(ret));
-        } else if (OB_FAIL(ems_heap_->push(chunk))) {
-          LOG_WARN("heap push failed", K(ret));
+        } else if (OB_FAIL(ems_loser_tree_->push(chunk))) {
+          LOG_WARN("loser tree push failed", K(ret));
         } else {
           chunk = chunk->get_next();
         }
       }
+      if (OB_SUCC(ret) && OB_FAIL(ems_loser_tree_->rebuild())) {
+        LOG_WARN("loser tree rebuild failed", K(ret));
+      }
     }
   }
   if (OB_SUCC(ret)) {
@@ -1613,21 +1642,49 @@ int ObSortOpImpl::heap_next(Heap &heap, const NextFunc &func, Item &item)
   return ret;
 }
 
+// Same iterate protocol as heap_next(), the winner chunk is advanced in place
+// and only the matches on its path are replayed.
 int ObSortOpImpl::ems_heap_next(ObSortOpChunk *&chunk)
 {
-  const auto f = [](ObSortOpChunk *&c, bool &is_end) {
-    int ret = OB_SUCCESS;
+  int ret = OB_SUCCESS;
+  ObSortOpChunk * const *top = NULL;
+  if (!is_inited()) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(ems_loser_tree_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("loser tree is NULL", K(ret));
+  } else if (!heap_iter_begin_) {
+    heap_iter_begin_ = true;
+  } else if (ems_loser_tree_->empty()) {
+    // do nothing
+  } else if (OB_FAIL(ems_loser_tree_->top(top))) {
+    LOG_WARN("get loser tree top failed", K(ret));
+  } else {
+    ObSortOpChunk *c = *top;
     if (OB_FAIL(c->iter_.get_next_row(c->row_))) {
       if (OB_ITER_END == ret) {
-        is_end = true;
         ret = OB_SUCCESS;
+        if (OB_FAIL(ems_loser_tree_->pop())) {
+          LOG_WARN("loser tree pop failed", K(ret));
+        }
       } else {
         LOG_WARN("get next row failed", K(ret));
       }
+    } else if (OB_FAIL(ems_loser_tree_->replace_top(c))) {
+      LOG_WARN("loser tree replace top failed", K(ret));
     }
-    return ret;
-  };
-  return heap_next(*ems_heap_, f, chunk);
+  }
+  if (OB_SUCC(ret)) {
+    if (ems_loser_tree_->empty()) {
+      ret = OB_ITER_END;
+    } else if (OB_FAIL(ems_loser_tree_->top(top))) {
+      LOG_WARN("get loser tree top failed", K(ret));
+    } else {
+      chunk = *top;
+    }
+  }
+  return ret;
 }
 
 int ObSortOpImpl::imms_heap_next(const ObChunkDatumStore::StoredRow *&store_row)
@@ -1973,6 +2030,8 @@ int ObSortOpImpl::add_heap_sort_row(const common::ObIArray<ObExpr*> &exprs,
       LOG_WARN("failed to generate new row", K(ret));
     } else if (OB_FAIL(topn_heap_->push(new_row))) {
       LOG_WARN("failed to push back row", K(ret));
+    } else if (OB_FAIL(update_topn_filter())) {
+      LOG_WARN("failed to update topn filter", K(ret));
     } else {
       store_row = new_row;
       LOG_DEBUG("in memory topn sort check add row", KPC(new_row));
@@ -2056,6 +2115,8 @@ int ObSortOpImpl::adjust_topn_heap(const common::ObIArray<ObExpr*> &exprs,
         LOG_WARN("failed to generate new row", K(ret));
       } else if (OB_FAIL(topn_heap_->replace_top(new_row))) {
         LOG_WARN("failed to replace top", K(ret));
+      } else if (OB_FAIL(update_topn_filter())) {
+        LOG_WARN("failed to update topn filter", K(ret));
       } else {
         store_row = new_row;
       }
@@ -2108,6 +2169,8 @@ int ObSortOpImpl::adjust_topn_heap_with_ties(const common::ObIArray<ObExpr*> &ex
       LOG_WARN("failed to generate new row", K(ret));
     } else if (OB_FAIL(topn_heap_->replace_top(new_row))) {
       LOG_WARN("failed to replace top", K(ret));
+    } else if (OB_FAIL(update_topn_filter())) {
+      LOG_WARN("failed to update topn filter", K(ret));
     } else if (OB_FALSE_IT(cmp = comp_.with_ties_cmp(copy_pre_heap_top_row, topn_heap_->top()))) {
     } else if (OB_FAIL(comp_.ret_)) {
       /* do nothing */
@@ -2144,6 +2207,28 @@ int ObSortOpImpl::adjust_topn_heap_with_ties(const common::ObIArray<ObExpr*> &ex
   return ret;
 }
 
+// Only rows sorting before the heap top can get into a full heap, publish the first sort key
+// of heap top to let table scan below skip micro blocks.
+int ObSortOpImpl::update_topn_filter()
+{
+  int ret = OB_SUCCESS;
+  const ObChunkDatumStore::StoredRow *top_row = NULL;
+  if (NULL == topn_filter_ || topn_heap_->count() < topn_cnt_ - outputted_rows_cnt_) {
+    // heap is not full
+  } else if (OB_ISNULL(top_row = topn_heap_->top())
+             || OB_ISNULL(sort_collations_) || OB_UNLIKELY(sort_collations_->empty())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected topn heap top or sort collations", K(ret), KP(top_row), KP(sort_collations_));
+  } else if (OB_UNLIKELY(sort_collations_->at(0).field_idx_ >= top_row->cnt_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("sort field out of row", K(ret), K(sort_collations_->at(0)), K(top_row->cnt_));
+  } else if (OB_FAIL(topn_filter_->update_boundary(
+              top_row->cells()[sort_collations_->at(0).field_idx_]))) {
+    LOG_WARN("failed to update topn boundary", K(ret));
+  }
+  return ret;
+}
+
 // copy exprs values to topn heap top row.
 int ObSortOpImpl::copy_to_topn_row(const common::ObIArray<ObExpr*> &exprs,
                                    ObIAllocator &alloc,
@@ -15,6 +15,7 @@
 
 #include "lib/container/ob_array.h"
 #include "lib/container/ob_heap.h"
+#include "lib/container/ob_loser_tree.h"
 #include "sql/engine/basic/ob_chunk_datum_store.h"
 #include "sql/engine/ob_sql_mem_mgr_processor.h"
 #include "sql/engine/sort/ob_sort_basic_info.h"
@@ -23,6 +24,7 @@ namespace oceanbase
 {
 namespace sql
 {
+class ObPushdownTopNFilter;
 
 struct ObSortOpChunk : public common::ObDLinkBase<ObSortOpChunk>
 {
@@ -237,6 +239,11 @@ public:
   {
     io_event_observer_ = observer;
   }
+  // boundary of the first sort key is published to %topn_filter once the topn heap is full
+  inline void set_topn_filter(ObPushdownTopNFilter *topn_filter)
+  {
+    topn_filter_ = topn_filter;
+  }
   void unregister_profile();
   void unregister_profile_if_necessary();
 
@@ -256,6 +263,8 @@ public:
     bool operator()(ObChunkDatumStore::StoredRow **l, ObChunkDatumStore::StoredRow **r);
     // compare function for external merge sort
     bool operator()(const ObSortOpChunk *l, const ObSortOpChunk *r);
+    // interface required by ObLoserTree, equal rows are not distinguished
+    int cmp(const ObSortOpChunk *l, const ObSortOpChunk *r, int64_t &cmp_ret);
 
     bool operator()(
         const common::ObIArray<ObExpr*> *l,
@@ -528,6 +537,7 @@ protected:
                        const ObChunkDatumStore::StoredRow *&store_row);
   int adjust_topn_heap_with_ties(const common::ObIArray<ObExpr*> &exprs,
                                  const ObChunkDatumStore::StoredRow *&store_row);
+  int update_topn_filter();
   //
   int copy_to_topn_row(const common::ObIArray<ObExpr*> &exprs,
                        ObIAllocator &alloc,
@@ -548,7 +558,7 @@ protected:
 
 protected:
   typedef common::ObBinaryHeap<ObChunkDatumStore::StoredRow **, Compare, 16> IMMSHeap;
-  typedef common::ObBinaryHeap<ObSortOpChunk *, Compare, MAX_MERGE_WAYS> EMSHeap;
+  typedef common::ObLoserTree<ObSortOpChunk *, Compare, MAX_MERGE_WAYS> EMSLoserTree;
   typedef common::ObBinaryHeap<ObChunkDatumStore::StoredRow *, Compare> TopnHeap;
   static const int64_t MAX_ROW_CNT = 268435456; // (2G / 8)
   static const int64_t STORE_ROW_HEADER_SIZE = sizeof(SortStoredRow);
@@ -576,8 +586,8 @@ protected:
   bool heap_iter_begin_;
   // heap for in-memory merge sort local order rows
   IMMSHeap *imms_heap_;
-  // heap for external merge sort
-  EMSHeap *ems_heap_;
+  // loser tree for external merge sort
+  EMSLoserTree *ems_loser_tree_;
   NextStoredRowFunc next_stored_row_func_;
   int64_t input_rows_;
   int64_t input_width_;
@@ -602,6 +612,7 @@ protected:
   bool use_heap_sort_;
   bool is_fetch_with_ties_;
   TopnHeap *topn_heap_;
+  ObPushdownTopNFilter *topn_filter_;
   int64_t ties_array_pos_;
   common::ObArray<SortStoredRow *> ties_array_;
   ObChunkDatumStore::StoredRow *last_ties_row_;
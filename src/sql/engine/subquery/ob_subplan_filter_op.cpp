@@ -24,7 +24,7 @@ namespace sql
 
 bool DatumRow::operator==(const DatumRow &other) const
 {
-  bool cmp = false;
+  bool cmp = true;
   if (cnt_ != other.cnt_) {
     cmp = false;
   } else {
@@ -49,6 +49,11 @@ ObSubQueryIterator::ObSubQueryIterator(ObOperator &op)
     onetime_plan_(false),
     init_plan_(false),
     inited_(false),
+    id_(-1),
+    parent_(NULL),
+    memory_used_(0),
+    hash_probe_cnt_(0),
+    hash_hit_cnt_(0),
     eval_ctx_(op.get_eval_ctx()),
     iter_brs_(NULL),
     batch_size_(0),
@@ -304,6 +309,35 @@ int ObSubQueryIterator::set_refactored(const DatumRow &row,
   return ret;
 }
 
+int ObSubQueryIterator::probe_hashmap(ObDatum &out, bool &found)
+{
+  int ret = OB_SUCCESS;
+  found = false;
+  if (!has_hashmap()) {
+    // hash optimizer disabled
+  } else if (OB_FAIL(get_curr_probe_row())) {
+    LOG_WARN("failed to get probe row", K(ret));
+  } else if (OB_FAIL(get_refactored(out))) {
+    if (OB_HASH_NOT_EXIST != ret) {
+      LOG_WARN("failed to find in hash map", K(ret));
+    } else {
+      ret = OB_SUCCESS;
+    }
+  } else {
+    found = true;
+    ++hash_hit_cnt_;
+  }
+  if (OB_SUCC(ret) && has_hashmap()) {
+    ++hash_probe_cnt_;
+  }
+  return ret;
+}
+
+bool ObSubQueryIterator::need_rewind_on_hit() const
+{
+  return NULL != parent_ && parent_->enable_px_batch_rescan();
+}
+
 int ObSubQueryIterator::reset_hash_map()
 {
   int ret = OB_SUCCESS;
@@ -380,7 +414,8 @@ ObSubPlanFilterSpec::ObSubPlanFilterSpec(ObIAllocator &alloc, const ObPhyOperato
     filter_exprs_(alloc),
     output_exprs_(alloc),
     left_rescan_params_(alloc),
-    right_rescan_params_(alloc)
+    right_rescan_params_(alloc),
+    deterministic_idxs_(ModulePageAllocator(alloc))
 {
 }
 
@@ -397,7 +432,8 @@ OB_SERIALIZE_MEMBER((ObSubPlanFilterSpec, ObOpSpec),
                     filter_exprs_,
                     output_exprs_,
                     left_rescan_params_,
-                    right_rescan_params_);
+                    right_rescan_params_,
+                    deterministic_idxs_);
 
 DEF_TO_STRING(ObSubPlanFilterSpec)
 {
@@ -412,7 +448,8 @@ DEF_TO_STRING(ObSubPlanFilterSpec)
        K_(init_plan_idxs),
        K_(one_time_idxs),
        K_(update_set),
-       K_(exec_param_idxs_inited));
+       K_(exec_param_idxs_inited),
+       K_(deterministic_idxs));
   J_OBJ_END();
   return pos;
 }
@@ -636,7 +673,8 @@ int ObSubPlanFilterOp::inner_open()
           //unittest or old version, do not init hashmap
         } else if (OB_FAIL(iter->init_mem_entity())) {
           LOG_WARN("failed to init mem_entity", K(ret));
-        } else if (MY_SPEC.exec_param_array_[i - 1].count() > 0) {
+        } else if (MY_SPEC.exec_param_array_[i - 1].count() > 0
+                   && MY_SPEC.deterministic_idxs_.has_member(i)) {
           //min of buckets is 16,
           //max will not exceed card of left_child and HASH_MAP_MEMORY_LIMIT/ObObj
           if (OB_FAIL(iter->init_hashmap(max(
@@ -691,6 +729,18 @@ int ObSubPlanFilterOp::inner_open()
 
 int ObSubPlanFilterOp::inner_close()
 {
+  int64_t probe_cnt = 0;
+  int64_t hit_cnt = 0;
+  FOREACH_CNT(it, subplan_iters_) {
+    if (NULL != *it) {
+      probe_cnt += (*it)->get_hash_probe_cnt();
+      hit_cnt += (*it)->get_hash_hit_cnt();
+    }
+  }
+  op_monitor_info_.otherstat_1_id_ = ObSqlMonitorStatIds::SUBQUERY_CACHE_PROBE_COUNT;
+  op_monitor_info_.otherstat_1_value_ = probe_cnt;
+  op_monitor_info_.otherstat_2_id_ = ObSqlMonitorStatIds::SUBQUERY_CACHE_HIT_COUNT;
+  op_monitor_info_.otherstat_2_value_ = hit_cnt;
   destroy_subplan_iters();
   destroy_update_set_mem();
   if (MY_SPEC.enable_das_group_rescan_) {
@@ -83,6 +83,12 @@ public:
   int get_refactored(common::ObDatum &out);
   //set row into hashmap
   int set_refactored(const DatumRow &row, const ObDatum &result, const int64_t deep_copy_size);
+  //fill curr exec param and probe hashmap, the subquery need not be rewound if found
+  int probe_hashmap(common::ObDatum &out, bool &found);
+  //px batch rescan consumes one rescan param per left row, rewind is needed even if cached
+  bool need_rewind_on_hit() const;
+  int64_t get_hash_probe_cnt() const { return hash_probe_cnt_; }
+  int64_t get_hash_hit_cnt() const { return hash_hit_cnt_; }
   void set_parent(const ObSubPlanFilterOp *filter) { parent_ = filter; }
   int reset_hash_map();
 
@@ -127,6 +133,8 @@ private:
   int64_t id_; // curr op_id in spf
   const ObSubPlanFilterOp *parent_; //needs to get exec_param_idxs_ from op
   int64_t memory_used_;
+  int64_t hash_probe_cnt_;
+  int64_t hash_hit_cnt_;
   ObEvalCtx &eval_ctx_;
 
   // for vectorized
@@ -173,6 +181,8 @@ public:
   ExprFixedArray output_exprs_;
   common::ObFixedArray<ObDynamicParamSetter, common::ObIAllocator> left_rescan_params_;
   common::ObFixedArray<ObDynamicParamSetter, common::ObIAllocator> right_rescan_params_;
+  //结果只由 exec param 决定的子查询 idxs，只有这些子查询可以用 hashmap 缓存结果
+  common::ObBitSet<common::OB_DEFAULT_BITSET_SIZE, common::ModulePageAllocator> deterministic_idxs_;
 };
 
 class ObSubPlanFilterOp : public ObOperator
@@ -199,7 +209,7 @@ public:
     return common::OB_SUCCESS;
   }
   int handle_next_row();
-  bool enable_px_batch_rescan() { return enable_left_px_batch_; }
+  bool enable_px_batch_rescan() const { return enable_left_px_batch_; }
   //for vectorized
   int inner_get_next_batch(const int64_t max_row_cnt);
   // for vectorized end
@@ -1327,6 +1327,33 @@ int ObTableScanOp::inner_open()
   return ret;
 }
 
+int ObTableScanOp::bind_topn_filter(ObPushdownTopNFilter &topn_filter, bool &is_bound)
+{
+  int ret = OB_SUCCESS;
+  const ObDASScanCtDef &scan_ctdef = MY_CTDEF.scan_ctdef_;
+  ObPushdownOperator *pd_op = tsc_rtdef_.scan_rtdef_.p_pd_expr_op_;
+  const ExprFixedArray &access_exprs = scan_ctdef.pd_expr_spec_.access_exprs_;
+  is_bound = false;
+  if (PHY_TABLE_SCAN != MY_SPEC.get_type() || MY_SPEC.is_vt_mapping_
+      || nullptr != MY_SPEC.limit_ || nullptr != MY_SPEC.offset_
+      || ObPushdownFilterUtils::is_aggregate_pushdown_storage(scan_ctdef.pd_expr_spec_.pd_storage_flag_)) {
+    // skipping rows changes the result of limit or aggregate pushed down
+  } else if (OB_ISNULL(pd_op)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("pushdown operator is null", K(ret));
+  } else if (access_exprs.count() != scan_ctdef.access_column_ids_.count()) {
+  } else {
+    for (int64_t i = 0; !is_bound && i < access_exprs.count(); ++i) {
+      if (access_exprs.at(i) == topn_filter.get_key_expr()) {
+        topn_filter.set_col_id(scan_ctdef.access_column_ids_.at(i));
+        pd_op->topn_filter_ = &topn_filter;
+        is_bound = true;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTableScanOp::inner_close()
 {
   int ret = OB_SUCCESS;
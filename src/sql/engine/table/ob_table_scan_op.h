@@ -386,6 +386,9 @@ public:
 
   void set_report_checksum(bool flag) { report_checksum_ = flag; }
   int reset_sample_scan() { tsc_rtdef_.scan_rtdef_.sample_info_ = nullptr; return close_and_reopen(); }
+  // let storage skip micro blocks by the boundary of top-n sort above,
+  // is_bound is false if the sort key is not a column of the scan or rows can not be skipped
+  int bind_topn_filter(ObPushdownTopNFilter &topn_filter, bool &is_bound);
   virtual void set_need_sample(bool flag) { UNUSED(flag); }
   static int transform_physical_rowid(common::ObIAllocator &allocator,
                                       const common::ObTabletID &scan_tablet_id,
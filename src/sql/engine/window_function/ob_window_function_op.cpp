@@ -1225,6 +1225,8 @@ int ObWindowFunctionOp::init()
               aggr_func->aggr_processor_.set_in_window_func();
               if (OB_FAIL(aggr_func->aggr_processor_.init())) {
                 LOG_WARN("failed to initialize init_group_rows", K(ret));
+              } else if (OB_FAIL(init_extremum_queue(*aggr_func))) {
+                LOG_WARN("failed to init extremum queue", K(ret));
               } else {
                 aggr_func->aggr_processor_.set_dir_id(dir_id_);
                 aggr_func->aggr_processor_.set_io_event_observer(&io_event_observer_);
@@ -1676,7 +1678,13 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
               K(row_idx), K(upper_has_null), K(lower_has_null), K(wf_cell));
     if (!upper_has_null && !lower_has_null && Frame::valid_frame(part_frame, new_frame)) {
       Frame::prune_frame(part_frame, new_frame);
-      if (wf_cell.is_aggr()) {
+      if (wf_cell.is_aggr() && NULL != static_cast<AggrCell &>(wf_cell).extremum_queue_) {
+        if (OB_FAIL(compute_sliding_extremum(static_cast<AggrCell &>(wf_cell), new_frame, val))) {
+          LOG_WARN("compute sliding extremum failed", K(ret), K(new_frame));
+        } else {
+          last_valid_frame = new_frame;
+        }
+      } else if (wf_cell.is_aggr()) {
         AggrCell *aggr_func = static_cast<AggrCell *>(&wf_cell);
         const ObRADatumStore::StoredRow *cur_row = NULL;
         if (!Frame::same_frame(last_valid_frame, new_frame)) {
@@ -1808,6 +1816,142 @@ int ObWindowFunctionOp::compute(RowsReader &row_reader, WinFuncCell &wf_cell,
   return ret;
 }
 
+int ObWindowFunctionOp::ExtremumQueue::expand()
+{
+  int ret = OB_SUCCESS;
+  const int64_t new_cap = std::max(2 * cap_, 16L);
+  Item *items = static_cast<Item *>(alloc_.alloc(sizeof(Item) * new_cap));
+  if (OB_ISNULL(items)) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(new_cap));
+  } else {
+    // buffers of items are moved to the new array
+    for (int64_t i = 0; i < cap_; i++) {
+      items[i] = at(i);
+    }
+    for (int64_t i = cap_; i < new_cap; i++) {
+      items[i].buf_ = NULL;
+      items[i].buf_size_ = 0;
+    }
+    if (NULL != items_) {
+      alloc_.free(items_);
+    }
+    items_ = items;
+    cap_ = new_cap;
+    begin_ = 0;
+  }
+  return ret;
+}
+
+int ObWindowFunctionOp::ExtremumQueue::push(const int64_t idx, const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  int cmp_ret = 0;
+  // rows dominated by the new row never become the extremum again
+  while (OB_SUCC(ret) && cnt_ > 0) {
+    if (OB_FAIL(cmp_func_(at(cnt_ - 1).datum_, datum, cmp_ret))) {
+      LOG_WARN("compare failed", K(ret));
+    } else if ((is_max_ && cmp_ret <= 0) || (!is_max_ && cmp_ret >= 0)) {
+      cnt_--;
+    } else {
+      break;
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (cnt_ == cap_ && OB_FAIL(expand())) {
+    LOG_WARN("expand failed", K(ret));
+  } else {
+    Item &item = at(cnt_);
+    if (datum.len_ > item.buf_size_) {
+      const int64_t size = next_pow2(datum.len_);
+      char *buf = static_cast<char *>(alloc_.alloc(size));
+      if (OB_ISNULL(buf)) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("allocate memory failed", K(ret), K(size));
+      } else {
+        if (NULL != item.buf_) {
+          alloc_.free(item.buf_);
+        }
+        item.buf_ = buf;
+        item.buf_size_ = size;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      MEMCPY(item.buf_, datum.ptr_, datum.len_);
+      item.datum_ = datum;
+      item.datum_.ptr_ = item.buf_;
+      item.idx_ = idx;
+      cnt_++;
+    }
+  }
+  return ret;
+}
+
+void ObWindowFunctionOp::ExtremumQueue::pop_before(const int64_t head)
+{
+  while (cnt_ > 0 && items_[begin_].idx_ < head) {
+    begin_ = (begin_ + 1) % cap_;
+    cnt_--;
+  }
+}
+
+int ObWindowFunctionOp::init_extremum_queue(AggrCell &aggr_func)
+{
+  int ret = OB_SUCCESS;
+  const WinFuncInfo &wf_info = aggr_func.wf_info_;
+  const ObAggrInfo &aggr_info = wf_info.aggr_info_;
+  ObExpr *param_expr = aggr_info.param_exprs_.count() == 1 ? aggr_info.param_exprs_.at(0) : NULL;
+  // push down reporting window function computes with the aggregate processor
+  if ((T_FUN_MAX != wf_info.func_type_ && T_FUN_MIN != wf_info.func_type_)
+      || MY_SPEC.is_push_down()
+      || NULL == param_expr
+      || NULL == param_expr->basic_funcs_
+      || NULL == param_expr->basic_funcs_->null_first_cmp_
+      || is_lob_storage(param_expr->datum_meta_.type_)
+      || param_expr->datum_meta_.type_ != aggr_info.expr_->datum_meta_.type_) {
+    // not supported
+  } else {
+    void *mem = local_allocator_.alloc(sizeof(ExtremumQueue));
+    if (OB_ISNULL(mem)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret));
+    } else {
+      aggr_func.extremum_queue_ = new (mem) ExtremumQueue(local_allocator_,
+                                                          param_expr->basic_funcs_->null_first_cmp_,
+                                                          T_FUN_MAX == wf_info.func_type_);
+    }
+  }
+  return ret;
+}
+
+int ObWindowFunctionOp::compute_sliding_extremum(AggrCell &aggr_func, const Frame &frame,
+                                                 ObDatum &val)
+{
+  int ret = OB_SUCCESS;
+  ExtremumQueue &queue = *aggr_func.extremum_queue_;
+  ObExpr *param_expr = aggr_func.wf_info_.aggr_info_.param_exprs_.at(0);
+  auto get_datum = [&](const int64_t idx, const ObDatum *&datum) {
+    int ret = OB_SUCCESS;
+    const ObRADatumStore::StoredRow *cur_row = NULL;
+    ObDatum *param = NULL;
+    if (OB_FAIL(input_rows_.cur_->get_row(idx, cur_row))) {
+      LOG_WARN("get cur row failed", K(ret), K(idx));
+    } else if (FALSE_IT(clear_evaluated_flag())) {
+    } else if (OB_FAIL(cur_row->to_expr(get_all_expr(), eval_ctx_))) {
+      LOG_WARN("Failed to to_expr", K(ret));
+    } else if (OB_FAIL(param_expr->eval(eval_ctx_, param))) {
+      LOG_WARN("eval param expr failed", K(ret));
+    } else {
+      datum = param;
+    }
+    return ret;
+  };
+  if (OB_FAIL(queue.slide(frame, get_datum, val))) {
+    LOG_WARN("slide extremum queue failed", K(ret), K(frame), K(queue));
+  }
+  return ret;
+}
+
 bool ObWindowFunctionOp::skip_calc(const int64_t wf_idx)
 {
   bool bret = false;
@@ -554,6 +554,83 @@ public:
     Frame last_valid_frame_;
   };
 
+  // Monotonic queue for sliding frame MIN/MAX. Rows of frame which may become the extremum
+  // are kept in row index order, values are strictly decreasing (MAX) or increasing (MIN)
+  // from front to back. Every row is pushed and popped at most once while the frame slides
+  // forward, so the whole partition is computed in O(n) instead of O(n * frame size).
+  class ExtremumQueue
+  {
+  public:
+    ExtremumQueue(common::ObIAllocator &alloc, ObExprCmpFuncType cmp_func, const bool is_max)
+      : alloc_(alloc), cmp_func_(cmp_func), is_max_(is_max), items_(NULL),
+        cap_(0), begin_(0), cnt_(0), frame_()
+    {}
+    // keep the item buffers for reuse
+    void reuse() { begin_ = 0; cnt_ = 0; frame_.head_ = frame_.tail_ = -1; }
+    int push(const int64_t idx, const common::ObDatum &datum);
+    void pop_before(const int64_t head);
+    inline bool is_empty() const { return 0 == cnt_; }
+    inline const common::ObDatum &front() const { return items_[begin_].datum_; }
+    // Slide the queue to @frame and set the extremum of @frame (null if no value) to @val.
+    // Rows not in the queue yet are fetched by get_datum(int64_t idx, const ObDatum *&datum).
+    template <typename GetDatumFunc>
+    int slide(const Frame &frame, GetDatumFunc get_datum, common::ObDatum &val)
+    {
+      int ret = common::OB_SUCCESS;
+      const common::ObDatum *datum = NULL;
+      if (-1 == frame_.head_
+          || frame.head_ < frame_.head_
+          || frame.tail_ < frame_.tail_
+          || frame.head_ > frame_.tail_) {
+        // frame does not slide forward, rebuild from the frame head
+        reuse();
+        frame_.head_ = frame.head_;
+        frame_.tail_ = frame.head_ - 1;
+      }
+      pop_before(frame.head_);
+      for (int64_t i = frame_.tail_ + 1; OB_SUCC(ret) && i <= frame.tail_; ++i) {
+        if (OB_FAIL(get_datum(i, datum))) {
+          SQL_ENG_LOG(WARN, "get datum failed", K(ret), K(i));
+        } else if (datum->is_null()) {
+          // null is ignored by MIN/MAX
+        } else if (OB_FAIL(push(i, *datum))) {
+          SQL_ENG_LOG(WARN, "push to extremum queue failed", K(ret), K(i));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        frame_ = frame;
+        if (is_empty()) {
+          val.set_null();
+        } else {
+          val = front();
+        }
+      }
+      return ret;
+    }
+    TO_STRING_KV(K_(is_max), K_(cap), K_(begin), K_(cnt), K_(frame));
+  private:
+    struct Item
+    {
+      int64_t idx_;
+      common::ObDatum datum_;
+      char *buf_;
+      int64_t buf_size_;
+    };
+    inline Item &at(const int64_t i) { return items_[(begin_ + i) % cap_]; }
+    int expand();
+  private:
+    common::ObIAllocator &alloc_;
+    ObExprCmpFuncType cmp_func_;
+    bool is_max_;
+    Item *items_;
+    int64_t cap_;
+    int64_t begin_;
+    int64_t cnt_;
+  public:
+    // rows in frame_ have been pushed
+    Frame frame_;
+  };
+
   class AggrCell : public WinFuncCell
   {
   public:
@@ -563,7 +640,8 @@ public:
         aggr_processor_(op_.eval_ctx_, aggr_infos, "WindowAggProc", op.get_monitor_info(), tenant_id),
         result_(),
         got_result_(false),
-        remove_type_(wf_info.remove_type_)
+        remove_type_(wf_info.remove_type_),
+        extremum_queue_(NULL)
     {}
     virtual ~AggrCell() { aggr_processor_.destroy(); }
     int trans(const ObRADatumStore::StoredRow &row)
@@ -600,6 +678,9 @@ public:
       aggr_processor_.reuse();
       result_.reset();
       got_result_ = false;
+      if (NULL != extremum_queue_) {
+        extremum_queue_->reuse();
+      }
     }
   public:
     bool finish_prepared_;
@@ -607,6 +688,8 @@ public:
     ObDatum result_;
     bool got_result_;
     uint64_t remove_type_;
+    // not null for MIN/MAX computed by sliding frame, %aggr_processor_ is not used then
+    ExtremumQueue *extremum_queue_;
   };
 
   class NonAggrCell : public WinFuncCell
@@ -812,6 +895,8 @@ protected:
   int compute(RowsReader &row_reader, WinFuncCell &wf_cell, const int64_t row_idx,
               common::ObDatum &val);
   int compute_push_down_by_pass(WinFuncCell &wf_cell, common::ObDatum &val);
+  int init_extremum_queue(AggrCell &aggr_func);
+  int compute_sliding_extremum(AggrCell &aggr_func, const Frame &frame, common::ObDatum &val);
   int check_same_partition(const ExprFixedArray &other_exprs,
                            bool &is_same_part,
                            const ExprFixedArray *curr_exprs = NULL);
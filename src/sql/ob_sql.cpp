@@ -2954,6 +2954,10 @@ int ObSql::generate_plan(ParseResult &parse_result,
                               result.is_ps_protocol(),
                               result.get_exec_context().get_stmt_factory()->get_query_ctx());
     optctx.set_aggregation_optimization_settings(aggregate_setting);
+    if (OB_NOT_NULL(result.get_session().get_plan_cache())) {
+      optctx.set_use_card_feedback_ds(result.get_session().get_plan_cache()->is_card_feedback_sql(
+                                      ObString(strlen(sql_ctx.sql_id_), sql_ctx.sql_id_)));
+    }
     pctx->set_field_array(result.get_field_columns());
     pctx->set_is_ps_protocol(result.is_ps_protocol());
     bool is_restore = false;
@@ -1257,6 +1257,15 @@ int ObDynamicSamplingUtils::get_valid_dynamic_sampling_level(const ObSQLSessionI
   return ret;
 }
 
+int64_t ObDynamicSamplingUtils::get_global_dynamic_sampling_level(ObOptimizerContext &ctx)
+{
+  int64_t global_ds_level = ctx.get_global_hint().get_dynamic_sampling();
+  if (ObGlobalHint::UNSET_DYNAMIC_SAMPLING == global_ds_level && ctx.use_card_feedback_ds()) {
+    global_ds_level = ObDynamicSamplingLevel::BASIC_DYNAMIC_SAMPLING;
+  }
+  return global_ds_level;
+}
+
 int ObDynamicSamplingUtils::get_ds_table_param(ObOptimizerContext &ctx,
                                                const ObLogPlan *log_plan,
                                                const OptTableMeta *table_meta,
@@ -1279,7 +1288,7 @@ int ObDynamicSamplingUtils::get_ds_table_param(ObOptimizerContext &ctx,
     //do nothing
   } else if (OB_FAIL(get_valid_dynamic_sampling_level(ctx.get_session_info(),
                                                       log_plan->get_log_plan_hint().get_dynamic_sampling_hint(table_meta->get_table_id()),
-                                                      ctx.get_global_hint().get_dynamic_sampling(),
+                                                      get_global_dynamic_sampling_level(ctx),
                                                       ignore_opt_stat ? false : table_meta->use_opt_stat(),
                                                       ds_level,
                                                       sample_block_cnt,
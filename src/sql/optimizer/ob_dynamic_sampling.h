@@ -353,6 +353,8 @@ public:
                                               int64_t &sample_block_cnt,
                                               bool &specify_ds);
 
+  static int64_t get_global_dynamic_sampling_level(ObOptimizerContext &ctx);
+
   static int get_ds_table_param(ObOptimizerContext &ctx,
                                 const ObLogPlan *log_plan,
                                 const OptTableMeta *table_meta,
@@ -188,6 +188,13 @@ public:
   inline bool is_adaptive_aggregate() const { return HASH_AGGREGATE == get_algo()
                                                      && !force_push_down()
                                                      && (is_first_stage() || (!is_three_stage_aggr() && is_push_down())); }
+  // hash aggregation of one stage, the executor scatters input rows to cache sized radix
+  // partitions when the estimated group count is large
+  inline bool use_radix_partition() const { return HASH_AGGREGATE == get_algo()
+                                                   && !is_three_stage_aggr()
+                                                   && !is_adaptive_aggregate()
+                                                   && !group_exprs_.empty()
+                                                   && rollup_exprs_.empty(); }
 
 
   inline void set_rollup_status(const ObRollupStatus rollup_status)
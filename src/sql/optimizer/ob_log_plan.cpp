@@ -65,6 +65,7 @@
 #include "sql/optimizer/ob_log_insert_all.h"
 #include "sql/optimizer/ob_log_merge.h"
 #include "sql/optimizer/ob_log_stat_collector.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "sql/optimizer/ob_update_log_plan.h"
 #include "sql/optimizer/ob_insert_log_plan.h"
@@ -2762,6 +2763,12 @@ int ObLogPlan::inner_generate_join_levels_with_IDP(common::ObIArray<JoinOrderArr
   } else {
     join_level = join_rels.at(0).count();
     uint32_t initial_idp_step = join_level;
+    int64_t dp_limit = get_join_order_dp_limit();
+    if (dp_limit > 0 && initial_idp_step > dp_limit) {
+      // 表太多时每轮只对dp_limit张表做动态规划, 退化为贪心的IDP
+      initial_idp_step = max(static_cast<uint32_t>(dp_limit), 2U);
+      OPT_TRACE("limit idp step by _optimizer_join_order_dp_limit", KV(initial_idp_step));
+    }
     if (OB_FAIL(init_idp(initial_idp_step, temp_join_rels, join_rels))) {
       LOG_WARN("failed to init idp", K(ret));
     } else {
@@ -2829,6 +2836,19 @@ int ObLogPlan::inner_generate_join_levels_with_IDP(common::ObIArray<JoinOrderArr
   return ret;
 }
 
+int64_t ObLogPlan::get_join_order_dp_limit()
+{
+  int64_t dp_limit = 0;
+  ObSQLSessionInfo *session_info = get_optimizer_context().get_session_info();
+  if (OB_NOT_NULL(session_info)) {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session_info->get_effective_tenant_id()));
+    if (tenant_config.is_valid()) {
+      dp_limit = tenant_config->_optimizer_join_order_dp_limit;
+    }
+  }
+  return dp_limit;
+}
+
 int ObLogPlan::do_one_round_idp(common::ObIArray<JoinOrderArray> &temp_join_rels,
                                 uint32_t curr_idp_step,
                                 bool ignore_hint,
@@ -3180,6 +3200,8 @@ int ObLogPlan::generate_single_join_level_with_DP(ObIArray<JoinOrderArray> &join
                      !is_valid_join) {
             abort_type = ObIDPAbortType::IDP_INVALID_HINT_ABORT;
             OPT_TRACE("leading hint is invalid, stop idp ", left_tree, right_tree);
+          } else if (!is_valid_join) {
+            // 非法的连接不会新增path, 不需要重新统计当前level的path数
           } else if (OB_FAIL(check_and_abort_curr_level_dp(join_rels,
                                                            level,
                                                            abort_type))) {
@@ -6975,7 +6997,8 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
       LOG_WARN("get unexpected null", K(ret));
     } else if (T_FUN_COUNT != cur_aggr->get_expr_type()
                && T_FUN_MIN != cur_aggr->get_expr_type()
-               && T_FUN_MAX != cur_aggr->get_expr_type()) {
+               && T_FUN_MAX != cur_aggr->get_expr_type()
+               && T_FUN_SUM != cur_aggr->get_expr_type()) {
       can_push = false;
     } else if (cur_aggr->is_param_distinct() || 1 < cur_aggr->get_real_param_count()) {
       /* mysql mode, support count(distinct c1, c2). if this distinct can be eliminated,
@@ -6989,6 +7012,11 @@ int ObLogPlan::check_scalar_groupby_pushdown(const ObIArray<ObAggFunRawExpr *> &
     } else if (!first_param->is_column_ref_expr() ||
                table_item->table_id_ != static_cast<ObColumnRefRawExpr*>(first_param)->get_table_id()) {
       can_push = false;
+    } else if (T_FUN_SUM == cur_aggr->get_expr_type() &&
+               !ObPushdownFilterUtils::is_sum_pushdown_supported(
+                   first_param->get_result_type().get_type(),
+                   cur_aggr->get_result_type().get_type())) {
+      can_push = false;
     }
   }
   return ret;
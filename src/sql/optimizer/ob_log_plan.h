@@ -1489,6 +1489,7 @@ protected:
 
   int generate_join_levels_with_orgleading(common::ObIArray<JoinOrderArray> &join_rels);
 
+  int64_t get_join_order_dp_limit();
   int do_one_round_idp(common::ObIArray<JoinOrderArray> &temp_join_rels,
                       uint32_t curr_idp_step,
                       bool ignore_hint,
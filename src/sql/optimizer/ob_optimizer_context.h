@@ -158,7 +158,8 @@ ObOptimizerContext(ObSQLSessionInfo *session_info,
     has_var_assign_(false),
     is_var_assign_only_in_root_stmt_(false),
     failed_ds_tab_list_(),
-    has_multiple_link_stmt_(false)
+    has_multiple_link_stmt_(false),
+    use_card_feedback_ds_(false)
   { }
   inline common::ObOptStatManager *get_opt_stat_manager() { return opt_stat_manager_; }
   inline void set_opt_stat_manager(common::ObOptStatManager *sm) { opt_stat_manager_ = sm; }
@@ -508,6 +509,8 @@ ObOptimizerContext(ObSQLSessionInfo *session_info,
   common::ObIArray<ObDSFailTabInfo> &get_failed_ds_tab_list() { return failed_ds_tab_list_; }
   inline bool has_multiple_link_stmt() const { return has_multiple_link_stmt_; }
   inline void set_has_multiple_link_stmt(bool v) { has_multiple_link_stmt_ = v; }
+  inline bool use_card_feedback_ds() const { return use_card_feedback_ds_; }
+  inline void set_use_card_feedback_ds(bool v) { use_card_feedback_ds_ = v; }
 private:
   ObSQLSessionInfo *session_info_;
   ObExecContext *exec_ctx_;
@@ -588,6 +591,8 @@ private:
   //record the dynamic sampling falied table list, avoid repeated dynamic sampling.
   common::ObSEArray<ObDSFailTabInfo, 1, common::ModulePageAllocator, true> failed_ds_tab_list_;
   bool has_multiple_link_stmt_;
+  // last plan of this sql got a bad cardinality estimation, use dynamic sampling like the hint
+  bool use_card_feedback_ds_;
 };
 }
 }
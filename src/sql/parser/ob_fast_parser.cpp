@@ -11,6 +11,9 @@
  */
 
 #define USING_LOG_PREFIX SQL_PARSER
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
 #include "ob_fast_parser.h"
 #include "sql/udr/ob_udr_struct.h"
 #include "share/ob_define.h"
@@ -20,6 +23,32 @@
 using namespace oceanbase::sql;
 using namespace oceanbase::common;
 
+// Return the position of the first quote or backslash in [pos, len), or len if not found.
+// String literals (e.g. long values of multi-row insert) are the longest tokens of a sql,
+// compare 16 bytes at a time instead of scanning them byte by byte.
+static inline int64_t find_quote_or_escape(const char *str,
+                                           int64_t pos,
+                                           const int64_t len,
+                                           const char quote)
+{
+#if defined(__x86_64__)
+  const __m128i quote_vec = _mm_set1_epi8(quote);
+  const __m128i escape_vec = _mm_set1_epi8('\\');
+  for (; pos + 16 <= len; pos += 16) {
+    const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i *>(str + pos));
+    const int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chars, quote_vec),
+                                                    _mm_cmpeq_epi8(chars, escape_vec)));
+    if (0 != mask) {
+      return pos + __builtin_ctz(mask);
+    }
+  }
+#endif
+  while (pos < len && '\\' != str[pos] && quote != str[pos]) {
+    ++pos;
+  }
+  return pos;
+}
+
 #define CHECK_AND_PROCESS_HINT(str, size) \
 do { \
   if (CHECK_EQ_STRNCASECMP(str, size)) { \
@@ -1945,8 +1974,10 @@ int ObFastParserMysql::process_string(const char quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end() && '\\' != ch && quote != ch) {
+        int64_t stop_pos = find_quote_or_escape(raw_sql_.raw_sql_, raw_sql_.cur_pos_ + 1,
+                                                raw_sql_.raw_sql_len_, quote);
+        ch = raw_sql_.scan(stop_pos - raw_sql_.cur_pos_);
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
@@ -2341,8 +2372,10 @@ int ObFastParserOracle::process_string(const bool in_q_quote)
     while (OB_SUCC(ret) && !raw_sql_.is_search_end()) {
       ch = raw_sql_.scan();
       int64_t copy_begin_pos = raw_sql_.cur_pos_;
-      while (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
-        ch = raw_sql_.scan();
+      if (!raw_sql_.is_search_end() && '\\' != ch && '\'' != ch) {
+        int64_t stop_pos = find_quote_or_escape(raw_sql_.raw_sql_, raw_sql_.cur_pos_ + 1,
+                                                raw_sql_.raw_sql_len_, '\'');
+        ch = raw_sql_.scan(stop_pos - raw_sql_.cur_pos_);
       }
       int64_t len = raw_sql_.cur_pos_ - copy_begin_pos;
       if (len > 0) {
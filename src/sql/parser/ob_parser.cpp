@@ -708,7 +708,29 @@ int ObParser::check_is_insert(common::ObIArray<common::ObString> &queries, bool
   } else if (queries.count() > 1) {
     // query个数大于1，multi query 不做优化
   } else {
-    ObString &sql_str = queries.at(0);
+    ObString sql_str = queries.at(0);
+    // loaders usually send the statement with leading blanks or a plain comment, skip them
+    // to make the multi values insert still foldable
+    bool need_skip = true;
+    while (need_skip && sql_str.length() > 0) {
+      if (ISSPACE(sql_str[0])) {
+        ++sql_str;
+      } else if (sql_str.length() > 2 && '/' == sql_str[0] && '*' == sql_str[1]
+                 && '!' != sql_str[2] && '+' != sql_str[2]) {
+        int64_t end_pos = 2;
+        while (end_pos + 1 < sql_str.length()
+               && !('*' == sql_str[end_pos] && '/' == sql_str[end_pos + 1])) {
+          ++end_pos;
+        }
+        if (end_pos + 1 >= sql_str.length()) {
+          need_skip = false;
+        } else {
+          sql_str += (end_pos + 2);
+        }
+      } else {
+        need_skip = false;
+      }
+    }
     is_ins = (sql_str.length() > 6 && 0 == STRNCASECMP(sql_str.ptr(), "insert", 6));
     is_replace = (sql_str.length() > 7 && 0 == STRNCASECMP(sql_str.ptr(), "replace", 7));
     is_ins = is_ins | is_replace;
@@ -716,6 +738,57 @@ int ObParser::check_is_insert(common::ObIArray<common::ObString> &queries, bool
   return ret;
 }
 
+// A multi values insert must have a top level ')' directly followed by ','.
+// It's checked by a light scan which skips quoted literals and comments, so that single
+// values insert don't need to pay for the INS_MULTI_VALUES parse before plan cache lookup.
+// False positive is fine, the parse below gives the real answer.
+bool ObParser::may_have_multi_values(const ObString &stmt) const
+{
+  bool bret = false;
+  bool is_no_backslash_escapes = false;
+  IS_NO_BACKSLASH_ESCAPES(sql_mode_, is_no_backslash_escapes);
+  // backslash is a plain char in oracle mode literals
+  const bool backslash_escapes = !is_no_backslash_escapes && !lib::is_oracle_mode();
+  const char *str = stmt.ptr();
+  const int64_t len = stmt.length();
+  int64_t depth = 0;
+  bool after_close = false;
+  for (int64_t i = 0; !bret && i < len; ++i) {
+    const char ch = str[i];
+    if (ISSPACE(ch)) {
+      // keep after_close
+    } else if ('\'' == ch || '"' == ch || '`' == ch) {
+      for (++i; i < len && ch != str[i]; ++i) {
+        if ('\\' == str[i] && '`' != ch && backslash_escapes) {
+          ++i;
+        }
+      }
+      after_close = false;
+    } else if (('/' == ch && i + 1 < len && '*' == str[i + 1])
+               || ('-' == ch && i + 1 < len && '-' == str[i + 1])
+               || ('#' == ch && lib::is_mysql_mode())) {
+      // comment between ')' and ',', be conservative
+      bret = after_close;
+      if ('/' == ch) {
+        for (i += 2; i + 1 < len && !('*' == str[i] && '/' == str[i + 1]); ++i) {}
+        ++i;
+      } else {
+        for (; i < len && '\n' != str[i]; ++i) {}
+      }
+    } else if ('(' == ch) {
+      ++depth;
+      after_close = false;
+    } else if (')' == ch) {
+      --depth;
+      after_close = (0 == depth);
+    } else {
+      bret = (',' == ch && after_close);
+      after_close = false;
+    }
+  }
+  return bret;
+}
+
 int ObParser::reconstruct_insert_sql(const common::ObString &stmt,
                                      common::ObIArray<common::ObString> &queries,
                                      common::ObIArray<common::ObString> &ins_queries,
@@ -730,6 +803,9 @@ int ObParser::reconstruct_insert_sql(const common::ObString &stmt,
   can_batch_exec = false;
   if (OB_FAIL(check_is_insert(queries, is_insert))) {
     LOG_WARN("fail to check is insert", K(ret));
+  } else if (is_insert && !may_have_multi_values(stmt)) {
+    // only one set of values, no need to parse it here
+    is_insert = false;
   }
   if (OB_SUCC(ret) && is_insert) {
     ObArenaAllocator allocator(CURRENT_CONTEXT->get_malloc_allocator());
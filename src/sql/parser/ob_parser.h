@@ -167,6 +167,7 @@ private:
                            common::ObString &trace_id);
   static bool is_trace_id_end(char ch);
   static bool is_space(char ch);
+  bool may_have_multi_values(const common::ObString &stmt) const;
   static int32_t get_well_formed_errlen(const struct ObCharsetInfo *charset_info,
                                         const char *err_begin,
                                         int32_t err_len);
@@ -322,6 +322,7 @@ void ObPlanCache::destroy()
     if (OB_SUCCESS != (cache_evict_all_obj())) {
       SQL_PC_LOG_RET(WARN, OB_ERROR, "fail to evict all lib cache cache");
     }
+    card_feedback_sql_set_.destroy();
     if (root_context_ != NULL) {
       DESTROY_CONTEXT(root_context_);
       root_context_ = NULL;
@@ -348,6 +349,11 @@ int ObPlanCache::init(int64_t hash_bucket, uint64_t tenant_id)
                                                   ObModIds::OB_HASH_NODE_PLAN_CACHE,
                                                   tenant_id))) {
       SQL_PC_LOG(WARN, "failed to init PlanCache", K(ret));
+    } else if (OB_FAIL(card_feedback_sql_set_.create(hash::cal_next_prime(MAX_CARD_FEEDBACK_SQL_NUM),
+                                                     "PlanCardFb",
+                                                     "PlanCardFb",
+                                                     tenant_id))) {
+      SQL_PC_LOG(WARN, "failed to init card feedback sql set", K(ret));
     } else if (OB_FAIL(TG_CREATE_TENANT(lib::TGDefIDs::PlanCacheEvict, tg_id_))) {
       LOG_WARN("failed to create tg", K(ret));
     } else if (OB_FAIL(TG_START(tg_id_))) {
@@ -1948,12 +1954,36 @@ void ObPlanCache::mtl_stop(ObPlanCache * &plan_cache)
   }
 }
 
+int ObPlanCache::add_card_feedback_sql(const ObString &sql_id)
+{
+  int ret = OB_SUCCESS;
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("plan cache not init", K(ret));
+  } else if (card_feedback_sql_set_.size() >= MAX_CARD_FEEDBACK_SQL_NUM) {
+    // too many misestimated sqls, leave them to statistics gathering
+  } else if (OB_FAIL(card_feedback_sql_set_.set_refactored(sql_id.hash(), 1 /*overwrite*/))) {
+    // the first executions of one sql may feed back concurrently, overwrite instead of
+    // reporting OB_HASH_EXIST
+    LOG_WARN("failed to add card feedback sql", K(ret), K(sql_id));
+  }
+  return ret;
+}
+
+bool ObPlanCache::is_card_feedback_sql(const ObString &sql_id) const
+{
+  return inited_ && !sql_id.empty()
+         && OB_HASH_EXIST == card_feedback_sql_set_.exist_refactored(sql_id.hash());
+}
+
 int ObPlanCache::flush_plan_cache()
 {
   int ret = OB_SUCCESS;
   observer::ObReqTimeGuard req_timeinfo_guard;
   if (OB_FAIL(cache_evict_all_plan())) {
     SQL_PC_LOG(ERROR, "Plan cache evict failed, please check", K(ret));
+  } else if (OB_FAIL(card_feedback_sql_set_.clear())) {
+    SQL_PC_LOG(WARN, "failed to clear card feedback sql set", K(ret));
   }
   ObArray<AllocCacheObjInfo> deleted_objs;
   int64_t safe_timestamp = INT64_MAX;
@@ -15,6 +15,7 @@
 
 #include "lib/net/ob_addr.h"
 #include "lib/hash/ob_hashmap.h"
+#include "lib/hash/ob_hashset.h"
 #include "lib/alloc/alloc_func.h"
 #include "sql/plan_cache/ob_plan_cache_util.h"
 #include "sql/plan_cache/ob_id_manager_allocator.h"
@@ -226,6 +227,8 @@ public:
   static const int64_t MAX_TENANT_MEM = ((int64_t)(1) << 40); // 1T
   typedef common::hash::ObHashMap<ObILibCacheKey*, ObILibCacheNode*> CacheKeyNodeMap;
   typedef common::ObSEArray<uint64_t, 1024> PlanIdArray;
+  typedef common::hash::ObHashSet<uint64_t> CardFeedbackSqlSet;
+  static const int64_t MAX_CARD_FEEDBACK_SQL_NUM = 10000;
 
   ObPlanCache();
   virtual ~ObPlanCache();
@@ -261,6 +264,12 @@ public:
                                   ObILibCacheObject *cache_obj);
   int evict_plan(uint64_t table_id);
   int evict_plan_by_table_name(uint64_t database_id, ObString tab_name);
+  /**
+   * cardinality feedback: sql whose plan got a bad cardinality estimation at first execution,
+   * it uses dynamic sampling at next hard parse
+   */
+  int add_card_feedback_sql(const common::ObString &sql_id);
+  bool is_card_feedback_sql(const common::ObString &sql_id) const;
 
   /**
    * memory related
@@ -314,11 +323,11 @@ public:
   int64_t get_bucket_num() const { return bucket_num_; }
 
   // access count related
-  void inc_access_cnt() { ATOMIC_INC(&pc_stat_.access_count_);}
+  void inc_access_cnt() { pc_stat_.access_count_.inc(); }
   void inc_hit_and_access_cnt()
   {
-    ATOMIC_INC(&pc_stat_.hit_count_);
-    ATOMIC_INC(&pc_stat_.access_count_);
+    pc_stat_.hit_count_.inc();
+    pc_stat_.access_count_.inc();
   }
 
   /*
@@ -453,6 +462,7 @@ private:
   ObLCObjectManager co_mgr_;
   ObLCNodeFactory cn_factory_;
   CacheKeyNodeMap cache_key_node_map_;
+  CardFeedbackSqlSet card_feedback_sql_set_;
   ObPlanCacheEliminationTask evict_task_;
   int tg_id_;
 };
@@ -18,6 +18,7 @@
 #include "lib/hash/ob_hashmap.h"
 #include "lib/hash_func/murmur_hash.h"
 #include "lib/time/ob_time_utility.h"
+#include "lib/metrics/ob_counter.h"
 #include "lib/allocator/ob_allocator.h"
 #include "lib/string/ob_string.h"
 #include "lib/utility/serialization.h"
@@ -447,16 +448,21 @@ struct ObPlanCacheCtx : public ObILibCacheCtx
 
 struct ObPlanCacheStat
 {
-  uint64_t access_count_;
-  uint64_t hit_count_;
+  // updated by every plan cache lookup. Per cpu slots padded to a cache line each keep
+  // worker threads on different cpus off each other's lines, sum up only when read.
+  common::ObCacheAlignedPCCounter access_count_;
+  common::ObCacheAlignedPCCounter hit_count_;
 
   ObPlanCacheStat()
-    : access_count_(0),
-      hit_count_(0)
+    : access_count_(),
+      hit_count_()
   {}
 
-  TO_STRING_KV("access_count", access_count_,
-               "hit_count", hit_count_);
+  int64_t get_access_count() const { return access_count_.value(); }
+  int64_t get_hit_count() const { return hit_count_.value(); }
+
+  TO_STRING_KV("access_count", get_access_count(),
+               "hit_count", get_hit_count());
 };
 
 }
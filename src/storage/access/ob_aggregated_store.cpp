@@ -18,6 +18,7 @@
 #include "storage/blocksstable/ob_micro_block_reader.h"
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_index_block_row_struct.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
 #include "storage/access/ob_table_access_param.h"
 #include "storage/access/ob_table_access_context.h"
 namespace oceanbase
@@ -30,7 +31,8 @@ ObAggCell::ObAggCell(
     const share::schema::ObColumnParam *col_param,
     sql::ObExpr *expr,
     common::ObIAllocator &allocator)
-    : col_idx_(col_idx), is_lob_col_(false), datum_(), col_param_(col_param), expr_(expr), allocator_(allocator)
+    : col_idx_(col_idx), store_col_idx_(OB_INVALID_INDEX), is_lob_col_(false), datum_(),
+      col_param_(col_param), expr_(expr), allocator_(allocator)
 {
   if (col_param_ != nullptr) {
     is_lob_col_ = col_param_->get_meta_type().is_lob_storage();
@@ -45,6 +47,7 @@ ObAggCell::~ObAggCell()
 void ObAggCell::reset()
 {
   col_idx_ = -1;
+  store_col_idx_ = OB_INVALID_INDEX;
   is_lob_col_ = false;
   expr_ = nullptr;
 }
@@ -71,6 +74,55 @@ int ObAggCell::fill_result(sql::ObEvalCtx &ctx,bool need_padding)
   return ret;
 }
 
+bool ObAggCell::can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  UNUSED(index_info);
+  return false;
+}
+
+int ObAggCell::get_col_agg(
+    const blocksstable::ObMicroIndexInfo &index_info,
+    blocksstable::ObSkipIndexColAgg &col_agg) const
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObAggRowReader agg_row_reader;
+  col_agg.reset();
+  if (!index_info.has_agg_row() || store_col_idx_ < 0) {
+    // no skip index for this column
+  } else if (OB_FAIL(agg_row_reader.init(index_info.agg_row_buf_, index_info.agg_buf_size_))) {
+    LOG_WARN("Failed to init agg row reader", K(ret), K(index_info));
+  } else if (OB_FAIL(agg_row_reader.get_col_agg(store_col_idx_, col_agg))) {
+    LOG_WARN("Failed to get column aggregate", K(ret), K_(store_col_idx));
+  }
+  return ret;
+}
+
+int ObAggCell::eval(const common::ObDatum &datum)
+{
+  UNUSED(datum);
+  int ret = OB_NOT_SUPPORTED;
+  LOG_WARN("eval datum is not supported", K(ret), K(*this));
+  return ret;
+}
+
+int ObAggCell::eval_batch(const common::ObDatum *datums, const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == datums && count > 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KP(datums), K(count));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+    if (OB_UNLIKELY(datums[i].is_nop())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected datum, can not process in batch", K(ret), K(i));
+    } else if (OB_FAIL(eval(datums[i]))) {
+      LOG_WARN("Failed to eval datum", K(ret), K(i), K(datums[i]));
+    }
+  }
+  return ret;
+}
+
 int ObAggCell::fill_default_if_need(blocksstable::ObStorageDatum &datum)
 {
   int ret = OB_SUCCESS;
@@ -243,14 +295,30 @@ int ObCountAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
   } else if (!exclude_null_) {
     row_count_ += index_info.get_row_count();
   } else {
-    // TODO, extract from pre-agginfo
-    ret = OB_NOT_SUPPORTED;
-    LOG_WARN("exclude null is not supported", K(ret));
+    blocksstable::ObSkipIndexColAgg col_agg;
+    if (OB_FAIL(get_col_agg(index_info, col_agg))) {
+      LOG_WARN("Failed to get column aggregate", K(ret), K(index_info));
+    } else if (OB_UNLIKELY(!col_agg.is_covered_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected, column is not covered by skip index", K(ret), K(index_info), K(*this));
+    } else {
+      row_count_ += index_info.get_row_count() - col_agg.null_count_;
+    }
   }
   LOG_DEBUG("after count index info", K(ret), K(index_info.get_row_count()), K(row_count_));
   return ret;
 }
 
+bool ObCountAggCell::can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  bool bret = !exclude_null_;
+  if (!bret) {
+    blocksstable::ObSkipIndexColAgg col_agg;
+    bret = OB_SUCCESS == get_col_agg(index_info, col_agg) && col_agg.is_covered_;
+  }
+  return bret;
+}
+
 int ObCountAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
 {
   UNUSED(need_padding);
@@ -422,10 +490,35 @@ int ObMinMaxAggCell::process(
 
 int ObMinMaxAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
 {
-  int ret = OB_NOT_SUPPORTED;
+  int ret = OB_SUCCESS;
+  blocksstable::ObSkipIndexColAgg col_agg;
+  if (OB_FAIL(get_col_agg(index_info, col_agg))) {
+    LOG_WARN("Failed to get column aggregate", K(ret), K(index_info));
+  } else if (OB_UNLIKELY(!col_agg.is_covered_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected, column is not covered by skip index", K(ret), K(index_info), K(*this));
+  } else if (!col_agg.has_min_max_) {
+    // all values in micro block are null
+  } else {
+    const common::ObDatum &agg_datum = is_min_ ? col_agg.min_ : col_agg.max_;
+    blocksstable::ObStorageDatum storage_datum;
+    storage_datum.set_string(agg_datum.ptr_, agg_datum.len_);
+    if (OB_FAIL(process(storage_datum))) {
+      LOG_WARN("Failed to process datum", K(ret), K(storage_datum), KPC(this));
+    }
+  }
+  LOG_DEBUG("after process index info", K(ret), K(col_agg), KPC(this));
   return ret;
 }
 
+bool ObMinMaxAggCell::can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  blocksstable::ObSkipIndexColAgg col_agg;
+  return OB_SUCCESS == get_col_agg(index_info, col_agg)
+      && col_agg.is_covered_
+      && (col_agg.has_min_max_ || col_agg.null_count_ == static_cast<int64_t>(index_info.get_row_count()));
+}
+
 int ObMinMaxAggCell::process(blocksstable::ObStorageDatum &storage_datum)
 {
   int ret = OB_SUCCESS;
@@ -465,6 +558,266 @@ int ObMinMaxAggCell::deep_copy_datum(const blocksstable::ObStorageDatum &src)
   return ret;
 }
 
+ObSumAggCell::ObSumAggCell(
+    const int32_t col_idx,
+    const share::schema::ObColumnParam *col_param,
+    sql::ObExpr *expr,
+    common::ObIAllocator &allocator)
+    : ObAggCell(col_idx, col_param, expr, allocator),
+      obj_tc_(ObNullTC),
+      has_value_(false),
+      sum_int_(0),
+      sum_uint_(0),
+      sum_double_(0),
+      sum_nmb_(),
+      agg_datum_buf_(allocator),
+      cell_data_ptrs_(nullptr)
+{
+  if (nullptr != col_param_) {
+    obj_tc_ = col_param_->get_meta_type().get_type_class();
+  }
+  sum_nmb_.set_zero();
+}
+
+void ObSumAggCell::reset()
+{
+  agg_datum_buf_.reset();
+  if (nullptr != cell_data_ptrs_) {
+    allocator_.free(cell_data_ptrs_);
+    cell_data_ptrs_ = nullptr;
+  }
+  ObAggCell::reset();
+  obj_tc_ = ObNullTC;
+  reuse();
+}
+
+void ObSumAggCell::reuse()
+{
+  ObAggCell::reuse();
+  has_value_ = false;
+  sum_int_ = 0;
+  sum_uint_ = 0;
+  sum_double_ = 0;
+  sum_nmb_.set_zero();
+}
+
+int ObSumAggCell::init(const int64_t batch_size)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  if (OB_ISNULL(col_param_) || OB_ISNULL(expr_) ||
+      OB_UNLIKELY(!sql::ObPushdownFilterUtils::is_sum_pushdown_supported(
+          col_param_->get_meta_type().get_type(), expr_->datum_meta_.type_))) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Sum on this column type can not be pushed down", K(ret), KPC(col_param_), KPC(expr_));
+  } else if (OB_FAIL(agg_datum_buf_.init(batch_size))) {
+    LOG_WARN("Failed to init agg datum buf", K(ret));
+  } else if (OB_ISNULL(buf = allocator_.alloc(sizeof(char*) * batch_size))) {
+    ret = common::OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("Failed to alloc cell data ptrs", K(ret), K(batch_size));
+  } else {
+    cell_data_ptrs_ = static_cast<const char**> (buf);
+  }
+  return ret;
+}
+
+int ObSumAggCell::process(blocksstable::ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObStorageDatum &storage_datum = row.storage_datums_[col_idx_];
+  if (OB_FAIL(fill_default_if_need(storage_datum))) {
+    LOG_WARN("Failed to fill default", K(ret), K(storage_datum), K(*this));
+  } else if (OB_FAIL(eval(storage_datum))) {
+    LOG_WARN("Failed to eval datum", K(ret), K(storage_datum), K(*this));
+  }
+  LOG_DEBUG("after process single row", K(storage_datum), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(
+    blocksstable::ObIMicroBlockReader *reader,
+    int64_t *row_ids,
+    const int64_t row_count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(reader) || OB_ISNULL(row_ids)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Uexpected, reader or row_ids is null", K(ret), KP(reader), KP(row_ids), K(row_count));
+  } else if (blocksstable::ObIMicroBlockReader::Reader == reader->get_type()) {
+    blocksstable::ObMicroBlockReader *block_reader = static_cast<blocksstable::ObMicroBlockReader*>(reader);
+    if (OB_FAIL(block_reader->get_aggregate_result(col_idx_, col_param_, row_ids, row_count, *this))) {
+      LOG_WARN("Failed to get aggregate result", K(ret), K(row_count), KPC(this));
+    }
+  } else {
+    // datums may be redirected to block data by previous batch, reset them to the local buffer
+    agg_datum_buf_.reuse();
+    blocksstable::ObMicroBlockDecoder *block_decoder = static_cast<blocksstable::ObMicroBlockDecoder*>(reader);
+    if (OB_FAIL(block_decoder->get_aggregate_result(col_idx_, row_ids, cell_data_ptrs_, row_count,
+                                                    agg_datum_buf_.get_datums(), *this))) {
+      LOG_WARN("Failed to get aggregate result", K(ret), K(row_count), KPC(this));
+    }
+  }
+  LOG_DEBUG("after process batch rows", K(ret), K(row_count), KPC(this));
+  return ret;
+}
+
+int ObSumAggCell::process(const blocksstable::ObMicroIndexInfo &index_info)
+{
+  UNUSED(index_info);
+  int ret = OB_NOT_SUPPORTED;
+  return ret;
+}
+
+int ObSumAggCell::eval(const common::ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (datum.is_null()) {
+  } else {
+    switch (obj_tc_) {
+      case ObIntTC: {
+        ret = add_int(datum.get_int());
+        break;
+      }
+      case ObUIntTC: {
+        ret = add_uint(datum.get_uint());
+        break;
+      }
+      case ObFloatTC: {
+        sum_double_ += datum.get_float();
+        break;
+      }
+      case ObDoubleTC: {
+        sum_double_ += datum.get_double();
+        break;
+      }
+      case ObNumberTC: {
+        const common::number::ObNumber nmb(datum.get_number());
+        ret = add_number(nmb);
+        break;
+      }
+      default: {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected column type for sum", K(ret), K_(obj_tc));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      has_value_ = true;
+    } else {
+      LOG_WARN("Failed to add datum", K(ret), K(datum), K(*this));
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_int(const int64_t value)
+{
+  int ret = OB_SUCCESS;
+  int64_t sum_int = 0;
+  if (OB_LIKELY(!__builtin_add_overflow(sum_int_, value, &sum_int))) {
+    sum_int_ = sum_int;
+  } else {
+    char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    common::number::ObNumber result_nmb;
+    if (OB_FAIL(sum_nmb_.add(sum_int_, value, result_nmb, allocator))) {
+      LOG_WARN("Failed to add number", K(ret), K_(sum_int), K(value));
+    } else {
+      sum_int_ = 0;
+      sum_nmb_.set_zero();
+      ret = add_number(result_nmb);
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_uint(const uint64_t value)
+{
+  int ret = OB_SUCCESS;
+  uint64_t sum_uint = 0;
+  if (OB_LIKELY(!__builtin_add_overflow(sum_uint_, value, &sum_uint))) {
+    sum_uint_ = sum_uint;
+  } else {
+    char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    common::number::ObNumber result_nmb;
+    if (OB_FAIL(sum_nmb_.add(sum_uint_, value, result_nmb, allocator))) {
+      LOG_WARN("Failed to add number", K(ret), K_(sum_uint), K(value));
+    } else {
+      sum_uint_ = 0;
+      sum_nmb_.set_zero();
+      ret = add_number(result_nmb);
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::add_number(const common::number::ObNumber &nmb)
+{
+  int ret = OB_SUCCESS;
+  char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+  common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+  common::number::ObNumber result_nmb;
+  if (OB_FAIL(sum_nmb_.add_v3(nmb, result_nmb, allocator))) {
+    LOG_WARN("Failed to add number", K(ret), K_(sum_nmb), K(nmb));
+  } else {
+    // result digits are copied back into the cell owned buffer, so no memory grows with row count
+    common::ObDataBuffer nmb_allocator(nmb_buf_, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    if (OB_FAIL(sum_nmb_.deep_copy_v3(result_nmb, nmb_allocator))) {
+      LOG_WARN("Failed to deep copy number", K(ret), K(result_nmb));
+    }
+  }
+  return ret;
+}
+
+int ObSumAggCell::get_number_result(common::number::ObNumber &result, common::ObIAllocator &allocator) const
+{
+  int ret = OB_SUCCESS;
+  if (ObIntTC == obj_tc_) {
+    if (OB_FAIL(sum_nmb_.add(sum_int_, static_cast<int64_t>(0), result, allocator))) {
+      LOG_WARN("Failed to add number", K(ret), K_(sum_int), K_(sum_nmb));
+    }
+  } else if (ObUIntTC == obj_tc_) {
+    if (OB_FAIL(sum_nmb_.add(sum_uint_, static_cast<uint64_t>(0), result, allocator))) {
+      LOG_WARN("Failed to add number", K(ret), K_(sum_uint), K_(sum_nmb));
+    }
+  } else {
+    result.shadow_copy(sum_nmb_);
+  }
+  return ret;
+}
+
+int ObSumAggCell::fill_result(sql::ObEvalCtx &ctx, bool need_padding)
+{
+  UNUSED(need_padding);
+  int ret = OB_SUCCESS;
+  ObDatum &result = expr_->locate_datum_for_write(ctx);
+  sql::ObEvalInfo &eval_info = expr_->get_eval_info(ctx);
+  if (!has_value_) {
+    result.set_null();
+  } else if (ObNumberType == expr_->datum_meta_.type_) {
+    char buf_alloc[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+    common::ObDataBuffer allocator(buf_alloc, common::number::ObNumber::MAX_CALC_BYTE_LEN);
+    common::number::ObNumber result_nmb;
+    if (OB_FAIL(get_number_result(result_nmb, allocator))) {
+      LOG_WARN("Failed to get number result", K(ret), K(*this));
+    } else {
+      result.set_number(result_nmb);
+    }
+  } else if (ObDoubleType == expr_->datum_meta_.type_) {
+    result.set_double(sum_double_);
+  } else if (ObFloatType == expr_->datum_meta_.type_) {
+    result.set_float(static_cast<float>(sum_double_));
+  } else {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected result type of sum", K(ret), K(expr_->datum_meta_), K(*this));
+  }
+  if (OB_SUCC(ret)) {
+    eval_info.evaluated_ = true;
+  }
+  LOG_DEBUG("fill result", K(result), KPC(this));
+  return ret;
+}
+
 ObAggRow::ObAggRow(common::ObIAllocator &allocator) :
     agg_cells_(allocator),
     need_exclude_null_(false),
@@ -574,16 +927,45 @@ int ObAggRow::init(const ObTableAccessParam &param, const int64_t batch_size)
           } else if (OB_FAIL(agg_cells_.push_back(cell))) {
             LOG_WARN("Failed to push back agg cell", K(ret), K(i));
           }
+        } else if (T_FUN_SUM == expr->type_) {
+          need_exclude_null_ = true;
+          const share::schema::ObColumnParam *col_param = out_cols_param->at(col_idx);
+          if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObSumAggCell))) ||
+              OB_ISNULL(cell = new(buf) ObSumAggCell(col_idx, col_param, expr, allocator_))) {
+            ret = OB_ALLOCATE_MEMORY_FAILED;
+            LOG_WARN("Failed to alloc memroy for agg cell", K(ret), K(i));
+          } else if (OB_FAIL(static_cast<ObSumAggCell*>(cell)->init(batch_size))) {
+            LOG_WARN("Failed to init ObSumAggCell", K(ret), KPC(cell));
+          } else if (OB_FAIL(agg_cells_.push_back(cell))) {
+            LOG_WARN("Failed to push back agg cell", K(ret), K(i));
+          }
         } else {
           ret = OB_NOT_SUPPORTED;
           LOG_WARN("Agg is not supported", K(ret), K(expr->type_));
         }
       }
     }
+    const ObITableReadInfo *read_info = param.iter_param_.get_read_info();
+    for (int64_t i = 0; OB_SUCC(ret) && nullptr != read_info && i < agg_cells_.count(); ++i) {
+      ObAggCell *cell = agg_cells_.at(i);
+      const int32_t col_idx = cell->get_col_idx();
+      if (col_idx >= 0 && col_idx < read_info->get_columns_index().count()) {
+        cell->set_store_col_idx(read_info->get_columns_index().at(col_idx));
+      }
+    }
   }
   return ret;
 }
 
+bool ObAggRow::can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
+{
+  bool bret = true;
+  for (int64_t i = 0; bret && i < agg_cells_.count(); ++i) {
+    bret = nullptr != agg_cells_.at(i) && agg_cells_.at(i)->can_use_index_info(index_info);
+  }
+  return bret;
+}
+
 ObAggregatedStore::ObAggregatedStore(const int64_t batch_size, sql::ObEvalCtx &eval_ctx, ObTableAccessContext &context)
     : ObBlockBatchedRowStore(batch_size, eval_ctx, context),
       is_firstrow_aggregated_(false),
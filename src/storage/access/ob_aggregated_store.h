@@ -14,6 +14,7 @@
 #define OB_STORAGE_OB_AGGREGATED_STORE_H_
 
 #include "sql/engine/expr/ob_expr.h"
+#include "lib/number/ob_number_v2.h"
 #include "storage/ob_i_store.h"
 #include "ob_block_batched_row_store.h"
 #include "storage/blocksstable/ob_datum_row.h"
@@ -25,6 +26,7 @@ namespace blocksstable
 {
 class ObMicroBlockDecoder;
 struct ObMicroIndexInfo;
+struct ObSkipIndexColAgg;
 }
 namespace storage
 {
@@ -40,6 +42,7 @@ public:
     COUNT,
     MINMAX,
     FIRST_ROW,
+    SUM,
   };
   ObAggCell(
       const int32_t col_idx,
@@ -56,15 +59,25 @@ public:
       int64_t *row_ids,
       const int64_t row_count) = 0;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) = 0;
+  // whether the micro block could be aggregated by its index info and skip index
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const;
+  // aggregate datums decoded by micro block readers, nop datums are not expected here
+  virtual int eval(const common::ObDatum &datum);
+  int eval_batch(const common::ObDatum *datums, const int64_t count);
   virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding);
   OB_INLINE bool is_lob_col() const { return is_lob_col_; }
   OB_INLINE int32_t get_col_idx() const { return col_idx_; }
-  TO_STRING_KV(K_(col_idx), K_(is_lob_col), K_(datum), KPC(col_param_), K_(expr));
+  OB_INLINE void set_store_col_idx(const int32_t store_col_idx) { store_col_idx_ = store_col_idx; }
+  TO_STRING_KV(K_(col_idx), K_(store_col_idx), K_(is_lob_col), K_(datum), KPC(col_param_), K_(expr));
 protected:
   int fill_default_if_need(blocksstable::ObStorageDatum &datum);
   int pad_column_if_need(blocksstable::ObStorageDatum &datum);
+  int get_col_agg(
+      const blocksstable::ObMicroIndexInfo &index_info,
+      blocksstable::ObSkipIndexColAgg &col_agg) const;
 protected:
   int32_t col_idx_;
+  int32_t store_col_idx_; // column index in sstable, used to locate skip index
   bool is_lob_col_;
   blocksstable::ObStorageDatum datum_;
   const share::schema::ObColumnParam *col_param_;
@@ -90,6 +103,8 @@ public:
       int64_t *row_ids,
       const int64_t row_count) override;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override
+  { UNUSED(index_info); return true; }
   virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
   INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(aggregated));
 private:
@@ -115,6 +130,7 @@ public:
       int64_t *row_ids,
       const int64_t row_count) override;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
    virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
    INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(exclude_null), K_(row_count));
 private:
@@ -158,6 +174,7 @@ public:
       int64_t *row_ids,
       const int64_t row_count) override;
   virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual bool can_use_index_info(const blocksstable::ObMicroIndexInfo &index_info) const override;
   INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(is_min), K_(cmp_fun), K_(agg_datum_buf));
 private:
   int deep_copy_datum(const blocksstable::ObStorageDatum &src);
@@ -169,7 +186,45 @@ private:
   common::ObArenaAllocator datum_allocator_;
 };
 
-// TODO sum
+class ObSumAggCell : public ObAggCell
+{
+public:
+  ObSumAggCell(
+      const int32_t col_idx,
+      const share::schema::ObColumnParam *col_param,
+      sql::ObExpr *expr,
+      common::ObIAllocator &allocator);
+  virtual ~ObSumAggCell() { reset(); };
+  virtual void reset() override;
+  virtual void reuse() override;
+  virtual ObAggCellType get_type() const override { return SUM; }
+  int init(const int64_t batch_size);
+  virtual int process(blocksstable::ObDatumRow &row) override;
+  virtual int process(
+      blocksstable::ObIMicroBlockReader *reader,
+      int64_t *row_ids,
+      const int64_t row_count) override;
+  virtual int process(const blocksstable::ObMicroIndexInfo &index_info) override;
+  virtual int eval(const common::ObDatum &datum) override;
+  virtual int fill_result(sql::ObEvalCtx &ctx, bool need_padding) override;
+  INHERIT_TO_STRING_KV("ObAggCell", ObAggCell, K_(obj_tc), K_(has_value), K_(sum_int), K_(sum_uint),
+      K_(sum_double), K_(sum_nmb), K_(agg_datum_buf));
+private:
+  int add_number(const common::number::ObNumber &nmb);
+  int add_int(const int64_t value);
+  int add_uint(const uint64_t value);
+  int get_number_result(common::number::ObNumber &result, common::ObIAllocator &allocator) const;
+  common::ObObjTypeClass obj_tc_;
+  bool has_value_;
+  // int/uint are accumulated in place and spilled to sum_nmb_ on overflow
+  int64_t sum_int_;
+  uint64_t sum_uint_;
+  double sum_double_;
+  common::number::ObNumber sum_nmb_;
+  char nmb_buf_[common::number::ObNumber::MAX_CALC_BYTE_LEN];
+  ObAggDatumBuf agg_datum_buf_;
+  const char **cell_data_ptrs_;
+};
 
 class ObAggRow
 {
@@ -182,6 +237,7 @@ public:
   OB_INLINE int64_t get_agg_count() const { return agg_cells_.count(); }
   OB_INLINE bool need_exclude_null() const { return need_exclude_null_; };
   OB_INLINE bool has_lob_column_out() const { return has_lob_column_out_; }
+  bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const;
   // void set_firstrow_aggregated(bool aggregated) { is_firstrow_aggregated_ = aggregated; }
   // bool is_firstrow_aggregated() const { return is_firstrow_aggregated_; }
   OB_INLINE ObAggCell* at(int64_t idx) { return agg_cells_.at(idx); }
@@ -219,10 +275,11 @@ public:
   OB_INLINE bool can_batched_aggregate() const { return is_firstrow_aggregated_; }
   OB_INLINE bool can_agg_index_info(const blocksstable::ObMicroIndexInfo &index_info) const
   { 
-    return filter_is_null() && !agg_row_.need_exclude_null() && can_batched_aggregate() &&
+    return filter_is_null() && can_batched_aggregate() &&
            index_info.can_blockscan(agg_row_.has_lob_column_out()) &&
            !index_info.is_left_border() &&
-           !index_info.is_right_border();
+           !index_info.is_right_border() &&
+           (!agg_row_.need_exclude_null() || agg_row_.can_agg_index_info(index_info));
   }
   OB_INLINE void set_end() { iter_end_flag_ = IterEndState::ITER_END; }
   int check_agg_in_row_mode(const ObTableIterParam &iter_param);
@@ -19,6 +19,8 @@
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/ob_micro_block_reader.h"
 #include "storage/blocksstable/ob_micro_block_row_scanner.h"
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "storage/blocksstable/ob_index_block_row_struct.h"
 #include "storage/access/ob_table_access_context.h"
 
 namespace oceanbase
@@ -32,9 +34,12 @@ namespace storage
 ObBlockRowStore::ObBlockRowStore(ObTableAccessContext &context)
     : is_inited_(false),
     context_(context),
+    read_info_(nullptr),
     can_blockscan_(false),
     filter_applied_(false),
-    disabled_(false)
+    disabled_(false),
+    topn_filter_(nullptr),
+    topn_col_offset_(OB_INVALID_INDEX)
 {}
 ObBlockRowStore::~ObBlockRowStore()
 {
@@ -56,7 +61,10 @@ void ObBlockRowStore::reset()
   }
   pd_filter_info_.col_capacity_ = 0;
   pd_filter_info_.filter_ = nullptr;
+  read_info_ = nullptr;
   disabled_ = false;
+  topn_filter_ = nullptr;
+  topn_col_offset_ = OB_INVALID_INDEX;
 }
 
 void ObBlockRowStore::reuse()
@@ -73,6 +81,7 @@ int ObBlockRowStore::init(const ObTableAccessParam &param)
   const ObTableIterParam &iter_param = param.iter_param_;
   int64_t out_col_cnt = iter_param.get_out_col_cnt();
   pd_filter_info_.is_pd_filter_ = iter_param.enable_pd_filter();
+  read_info_ = iter_param.get_read_info();
   const bool need_padding = is_pad_char_to_full_length(context_.sql_mode_);
   if (IS_INIT) {
     ret = OB_INIT_TWICE;
@@ -104,6 +113,11 @@ int ObBlockRowStore::init(const ObTableAccessParam &param)
     is_inited_ = true;
   }
 
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(init_topn_filter(iter_param, need_padding))) {
+    LOG_WARN("Failed to init topn filter", K(ret));
+    is_inited_ = false;
+  }
   if (IS_NOT_INIT) {
     reset();
   }
@@ -228,6 +242,262 @@ int ObBlockRowStore::get_result_bitmap(const common::ObBitmap *&bitmap)
   return ret;
 }
 
+int ObBlockRowStore::check_skip_index(const ObMicroIndexInfo &index_info, bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  ObAggRowReader agg_row_reader;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("ObBlockRowStore is not inited", K(ret), K(*this));
+  } else if (nullptr == read_info_ || !index_info.has_agg_row()) {
+  } else if ((!pd_filter_info_.is_pd_filter_ || nullptr == pd_filter_info_.filter_)
+             && nullptr == topn_filter_) {
+  } else if (OB_FAIL(agg_row_reader.init(index_info.agg_row_buf_, index_info.agg_buf_size_))) {
+    LOG_WARN("Failed to init agg row reader", K(ret), K(index_info));
+  } else if (pd_filter_info_.is_pd_filter_ && nullptr != pd_filter_info_.filter_
+             && OB_FAIL(check_filter_skip_index(agg_row_reader,
+                                                index_info.get_row_count(),
+                                                *pd_filter_info_.filter_,
+                                                can_skip))) {
+    LOG_WARN("Failed to check skip index", K(ret), K(index_info));
+  } else if (!can_skip && nullptr != topn_filter_
+             && OB_FAIL(check_topn_skip_index(agg_row_reader, can_skip))) {
+    LOG_WARN("Failed to check topn skip index", K(ret), K(index_info));
+  } else if (can_skip) {
+    LOG_DEBUG("[PUSHDOWN] skip micro block by skip index", K(index_info));
+  }
+  return ret;
+}
+
+int ObBlockRowStore::check_filter_skip_index(
+    const ObAggRowReader &agg_row_reader,
+    const int64_t row_count,
+    sql::ObPushdownFilterExecutor &filter,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  if (filter.is_filter_white_node()) {
+    if (OB_FAIL(check_white_filter_skip_index(agg_row_reader,
+                                              row_count,
+                                              static_cast<sql::ObWhiteFilterExecutor &>(filter),
+                                              can_skip))) {
+      LOG_WARN("Failed to check white filter skip index", K(ret));
+    }
+  } else if (filter.is_filter_black_node()) {
+    if (OB_FAIL(check_black_filter_skip_index(agg_row_reader,
+                                              static_cast<sql::ObBlackFilterExecutor &>(filter),
+                                              can_skip))) {
+      LOG_WARN("Failed to check black filter skip index", K(ret));
+    }
+  } else if (filter.is_logic_op_node()) {
+    // and node: skip if any child skips, or node: skip only if all children skip
+    const bool is_and = filter.is_logic_and_node();
+    sql::ObPushdownFilterExecutor **children = filter.get_childs();
+    can_skip = !is_and;
+    for (uint32_t i = 0; OB_SUCC(ret) && i < filter.get_child_count(); i++) {
+      bool child_can_skip = false;
+      if (OB_ISNULL(children[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected null child filter", K(ret));
+      } else if (OB_FAIL(check_filter_skip_index(agg_row_reader, row_count, *children[i], child_can_skip))) {
+        LOG_WARN("Failed to check child skip index", K(ret), K(i));
+      } else if (is_and && child_can_skip) {
+        can_skip = true;
+        break;
+      } else if (!is_and && !child_can_skip) {
+        can_skip = false;
+        break;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObBlockRowStore::check_black_filter_skip_index(
+    const ObAggRowReader &agg_row_reader,
+    sql::ObBlackFilterExecutor &filter,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  ObSkipIndexColAgg col_agg;
+  int32_t col_offset = OB_INVALID_INDEX;
+  int32_t store_col_idx = OB_INVALID_INDEX;
+  if (1 != filter.get_col_offsets().count() || nullptr != filter.get_col_params().at(0)) {
+  } else if (FALSE_IT(col_offset = filter.get_col_offsets().at(0))) {
+  } else if (col_offset < 0 || col_offset >= read_info_->get_columns_index().count()) {
+  } else if (FALSE_IT(store_col_idx = read_info_->get_columns_index().at(col_offset))) {
+  } else if (OB_FAIL(agg_row_reader.get_col_agg(store_col_idx, col_agg))) {
+    LOG_WARN("Failed to get column aggregate", K(ret), K(store_col_idx));
+  } else if (!col_agg.is_covered_ || !col_agg.has_min_max_) {
+  } else if (OB_FAIL(filter.filter_by_min_max(col_agg.min_, col_agg.max_, can_skip))) {
+    LOG_WARN("Failed to filter by min max", K(ret), K(col_agg));
+  }
+  return ret;
+}
+
+int ObBlockRowStore::init_topn_filter(const ObTableIterParam &iter_param, const bool need_padding)
+{
+  int ret = OB_SUCCESS;
+  const sql::ObPushdownTopNFilter *topn_filter = nullptr;
+  const ObIArray<share::schema::ObColumnParam *> *col_params = iter_param.get_col_params();
+  bool found = false;
+  topn_filter_ = nullptr;
+  topn_col_offset_ = OB_INVALID_INDEX;
+  if (nullptr == iter_param.op_ || nullptr == (topn_filter = iter_param.op_->topn_filter_)) {
+  } else if (OB_ISNULL(col_params) || OB_ISNULL(iter_param.out_cols_project_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null col params or projector", K(ret), KP(col_params));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && !found && i < iter_param.out_cols_project_->count(); ++i) {
+      const int32_t idx = iter_param.out_cols_project_->at(i);
+      if (OB_UNLIKELY(idx < 0 || idx >= col_params->count()) || OB_ISNULL(col_params->at(idx))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Unexpected col projector", K(ret), K(idx), K(col_params->count()));
+      } else if (topn_filter->get_col_id() == col_params->at(idx)->get_column_id()) {
+        const ObObjMeta &col_type = col_params->at(idx)->get_meta_type();
+        found = true;
+        // min/max of skip index is the stored value, which is not comparable for padded char and lob
+        if (!(need_padding && col_type.is_fixed_len_char_type()) && !col_type.is_lob_storage()) {
+          topn_col_offset_ = idx;
+          topn_filter_ = topn_filter;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int ObBlockRowStore::check_topn_skip_index(
+    const ObAggRowReader &agg_row_reader,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  ObSkipIndexColAgg col_agg;
+  int32_t store_col_idx = OB_INVALID_INDEX;
+  if (topn_col_offset_ < 0 || topn_col_offset_ >= read_info_->get_columns_index().count()) {
+  } else if (FALSE_IT(store_col_idx = read_info_->get_columns_index().at(topn_col_offset_))) {
+  } else if (OB_FAIL(agg_row_reader.get_col_agg(store_col_idx, col_agg))) {
+    LOG_WARN("Failed to get column aggregate", K(ret), K(store_col_idx));
+  } else if (!col_agg.is_covered_ || !col_agg.has_min_max_) {
+  } else if (OB_FAIL(topn_filter_->check_min_max(col_agg.min_, col_agg.max_,
+                                                 col_agg.null_count_ > 0, can_skip))) {
+    LOG_WARN("Failed to check topn boundary", K(ret), K(col_agg), KPC_(topn_filter));
+  }
+  return ret;
+}
+
+int ObBlockRowStore::check_white_filter_skip_index(
+    const ObAggRowReader &agg_row_reader,
+    const int64_t row_count,
+    sql::ObWhiteFilterExecutor &filter,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  ObSkipIndexColAgg col_agg;
+  int32_t col_offset = OB_INVALID_INDEX;
+  int32_t store_col_idx = OB_INVALID_INDEX;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  const common::ObIArray<ObObj> &params = filter.get_objs();
+  if (1 != filter.get_col_offsets().count() || nullptr != filter.get_col_params().at(0)) {
+    // char column need padding, stored min/max can not be compared directly
+  } else if (FALSE_IT(col_offset = filter.get_col_offsets().at(0))) {
+  } else if (col_offset < 0 || col_offset >= read_info_->get_columns_index().count()) {
+  } else if (FALSE_IT(store_col_idx = read_info_->get_columns_index().at(col_offset))) {
+  } else if (OB_FAIL(agg_row_reader.get_col_agg(store_col_idx, col_agg))) {
+    LOG_WARN("Failed to get column aggregate", K(ret), K(store_col_idx));
+  } else if (!col_agg.is_covered_) {
+  } else if (sql::WHITE_OP_NU == op_type) {
+    can_skip = 0 == col_agg.null_count_;
+  } else if (col_agg.null_count_ == row_count) {
+    // all values are null, only is null could be true
+    can_skip = true;
+  } else if (sql::WHITE_OP_NN == op_type) {
+  } else if (filter.null_param_contained() && sql::WHITE_OP_IN != op_type) {
+    can_skip = true;
+  } else if (!col_agg.has_min_max_) {
+  } else {
+    const ObObjMeta &col_type = read_info_->get_columns_desc().at(col_offset).col_type_;
+    const ObCollationType cs_type = col_type.get_collation_type();
+    ObObj min_obj;
+    ObObj max_obj;
+    if (OB_FAIL(col_agg.min_.to_obj(min_obj, col_type))) {
+      LOG_WARN("Failed to convert min datum to obj", K(ret), K(col_agg), K(col_type));
+    } else if (OB_FAIL(col_agg.max_.to_obj(max_obj, col_type))) {
+      LOG_WARN("Failed to convert max datum to obj", K(ret), K(col_agg), K(col_type));
+    } else {
+      switch (op_type) {
+        case sql::WHITE_OP_EQ: {
+          can_skip = ObObjCmpFuncs::compare_oper_nullsafe(params.at(0), min_obj, cs_type, CO_LT)
+              || ObObjCmpFuncs::compare_oper_nullsafe(params.at(0), max_obj, cs_type, CO_GT);
+          break;
+        }
+        case sql::WHITE_OP_LT: {
+          can_skip = ObObjCmpFuncs::compare_oper_nullsafe(min_obj, params.at(0), cs_type, CO_GE);
+          break;
+        }
+        case sql::WHITE_OP_LE: {
+          can_skip = ObObjCmpFuncs::compare_oper_nullsafe(min_obj, params.at(0), cs_type, CO_GT);
+          break;
+        }
+        case sql::WHITE_OP_GT: {
+          can_skip = ObObjCmpFuncs::compare_oper_nullsafe(max_obj, params.at(0), cs_type, CO_LE);
+          break;
+        }
+        case sql::WHITE_OP_GE: {
+          can_skip = ObObjCmpFuncs::compare_oper_nullsafe(max_obj, params.at(0), cs_type, CO_LT);
+          break;
+        }
+        case sql::WHITE_OP_NE: {
+          can_skip = ObObjCmpFuncs::compare_oper_nullsafe(min_obj, params.at(0), cs_type, CO_EQ)
+              && ObObjCmpFuncs::compare_oper_nullsafe(max_obj, params.at(0), cs_type, CO_EQ);
+          break;
+        }
+        case sql::WHITE_OP_BT: {
+          can_skip = ObObjCmpFuncs::compare_oper_nullsafe(max_obj, params.at(0), cs_type, CO_LT)
+              || ObObjCmpFuncs::compare_oper_nullsafe(min_obj, params.at(1), cs_type, CO_GT);
+          break;
+        }
+        case sql::WHITE_OP_IN: {
+          can_skip = true;
+          for (int64_t i = 0; can_skip && i < params.count(); ++i) {
+            const ObObj &param = params.at(i);
+            if (param.is_null()) {
+            } else if (!ObObjCmpFuncs::compare_oper_nullsafe(param, min_obj, cs_type, CO_LT)
+                && !ObObjCmpFuncs::compare_oper_nullsafe(param, max_obj, cs_type, CO_GT)) {
+              can_skip = false;
+            }
+          }
+          break;
+        }
+        case sql::WHITE_OP_LI: {
+          // LIKE prefix matches bytewise, only binary collation (no pad space) keeps
+          // min/max in byte order. With pad space, 'abc\n' < 'abc' but 'abc\n' LIKE 'abc%'.
+          if (filter.is_prefix_like() && CS_TYPE_BINARY == cs_type) {
+            const ObString &prefix = filter.get_like_prefix();
+            const ObString min_str = min_obj.get_string();
+            const ObString max_str = max_obj.get_string();
+            const int max_cmp = MEMCMP(max_str.ptr(), prefix.ptr(), MIN(max_str.length(), prefix.length()));
+            // every matched value starts with prefix, so it is in [prefix, prefix + 0xFF...]
+            can_skip = max_cmp < 0 || (0 == max_cmp && max_str.length() < prefix.length())
+                || 0 < MEMCMP(min_str.ptr(), prefix.ptr(), MIN(min_str.length(), prefix.length()));
+          }
+          break;
+        }
+        default: {
+          // other operators are not supported by skip index
+          break;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObBlockRowStore::open()
 {
   int ret = OB_SUCCESS;
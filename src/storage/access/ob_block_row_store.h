@@ -23,16 +23,21 @@ namespace oceanbase
 namespace sql
 {
 class ObPushdownFilterExecutor;
+class ObPushdownTopNFilter;
 class ObBlackFilterExecutor;
+class ObWhiteFilterExecutor;
 }
 namespace blocksstable
 {
 class ObIMicroBlockRowScanner;
 class ObMicroBlockDecoder;
 class ObStorageDatum;
+class ObAggRowReader;
+struct ObMicroIndexInfo;
 }
 namespace storage
 {
+class ObITableReadInfo;
 struct ObTableAccessContext;
 struct ObTableAccessParam;
 struct ObTableIterParam;
@@ -80,6 +85,8 @@ public:
       const bool can_pushdown,
       ObTableStoreStat &table_store_stat);
   int get_result_bitmap(const common::ObBitmap *&bitmap);
+  // check whether no row in the micro block could pass pushdown filter by its skip index
+  int check_skip_index(const blocksstable::ObMicroIndexInfo &index_info, bool &can_skip);
   virtual bool is_end() const { return false; }
   virtual bool is_empty() const { return true; }
   virtual int filter_micro_block_batch(
@@ -101,10 +108,33 @@ protected:
   bool is_inited_;
   PushdownFilterInfo pd_filter_info_;
   ObTableAccessContext &context_;
+  const ObITableReadInfo *read_info_;
+private:
+  int check_filter_skip_index(
+      const blocksstable::ObAggRowReader &agg_row_reader,
+      const int64_t row_count,
+      sql::ObPushdownFilterExecutor &filter,
+      bool &can_skip);
+  int check_black_filter_skip_index(
+      const blocksstable::ObAggRowReader &agg_row_reader,
+      sql::ObBlackFilterExecutor &filter,
+      bool &can_skip);
+  int check_white_filter_skip_index(
+      const blocksstable::ObAggRowReader &agg_row_reader,
+      const int64_t row_count,
+      sql::ObWhiteFilterExecutor &filter,
+      bool &can_skip);
+  int init_topn_filter(const ObTableIterParam &iter_param, const bool need_padding);
+  int check_topn_skip_index(
+      const blocksstable::ObAggRowReader &agg_row_reader,
+      bool &can_skip);
 private:
   bool can_blockscan_;
   bool filter_applied_;
   bool disabled_;
+  // boundary of the top-n sort above the scan
+  const sql::ObPushdownTopNFilter *topn_filter_;
+  int32_t topn_col_offset_;
 };
 
 }
@@ -688,6 +688,7 @@ void ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::
   micro_data_prefetch_idx_ = 0;
   row_lock_check_version_ = transaction::ObTransVersion::INVALID_TRANS_VERSION;
   agg_row_store_ = nullptr;
+  block_row_store_ = nullptr;
   max_micro_handle_cnt_ = 0;
   iter_type_ = 0;
   cur_level_ = 0;
@@ -714,6 +715,7 @@ void ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::
   micro_data_prefetch_idx_ = 0;
   row_lock_check_version_ = transaction::ObTransVersion::INVALID_TRANS_VERSION;
   agg_row_store_ = nullptr;
+  block_row_store_ = nullptr;
   prefetch_depth_ = 1;
   total_micro_data_cnt_ = 0;
   for (int64_t i = 0; i < tree_handles_.count(); i++) {
@@ -1038,6 +1040,7 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::p
         while (OB_SUCC(ret) && prefetched_cnt < prefetch_depth) {
           prefetch_micro_idx = micro_data_prefetch_idx_ % max_micro_handle_cnt_;
           ObMicroIndexInfo &block_info = micro_data_infos_[prefetch_micro_idx];
+          bool can_skip = false;
           if (OB_FAIL(tree_handles_[cur_level_].get_next_data_row(block_info))) {
             if (OB_UNLIKELY(OB_ITER_END != ret)) {
               LOG_WARN("fail to get next", K(ret), K(cur_level_), K(tree_handles_[cur_level_]));
@@ -1046,6 +1049,10 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::p
               ret = OB_SUCCESS;
               break;
             }
+          } else if (OB_FAIL(check_skip_index(block_info, can_skip))) {
+            LOG_WARN("Fail to check skip index", K(ret), K(block_info));
+          } else if (can_skip) {
+            continue;
           } else if (nullptr != agg_row_store_ && agg_row_store_->can_agg_index_info(block_info)) {
             if (OB_FAIL(agg_row_store_->fill_index_info(block_info))) {
               LOG_WARN("Fail to agg index info", K(ret), K(block_info), KPC(this));
@@ -1427,6 +1434,22 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::c
   return ret;
 }
 
+template <int32_t DATA_PREFETCH_DEPTH, int32_t INDEX_PREFETCH_DEPTH>
+int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::check_skip_index(
+    const blocksstable::ObMicroIndexInfo &index_info,
+    bool &can_skip)
+{
+  int ret = OB_SUCCESS;
+  can_skip = false;
+  if (nullptr == block_row_store_
+      || !index_info.has_agg_row()
+      || !index_info.can_blockscan(iter_param_->has_lob_column_out())) {
+  } else if (OB_FAIL(block_row_store_->check_skip_index(index_info, can_skip))) {
+    LOG_WARN("Fail to check skip index", K(ret), K(index_info));
+  }
+  return ret;
+}
+
 //////////////////////////////////////// ObIndexTreeLevelHandle //////////////////////////////////////////////
 template <int32_t DATA_PREFETCH_DEPTH, int32_t INDEX_PREFETCH_DEPTH>
 int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::ObIndexTreeLevelHandle::prefetch(
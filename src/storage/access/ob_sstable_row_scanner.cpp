@@ -89,6 +89,9 @@ int ObSSTableRowScanner<PrefetchType>::inner_open(
       if (iter_param_->enable_pd_aggregate() && nullptr != block_row_store_ && !sstable_->is_multi_version_table()) {
         prefetcher_.agg_row_store_ = reinterpret_cast<ObAggregatedStore *>(block_row_store_);
       }
+      if (nullptr != block_row_store_ && !sstable_->is_multi_version_table()) {
+        prefetcher_.block_row_store_ = block_row_store_;
+      }
       if (OB_FAIL(prefetcher_.prefetch())) {
         LOG_WARN("ObSSTableRowScanner prefetch failed", K(ret));
       } else {
@@ -16,6 +16,7 @@
 #include "ob_dict_decoder.h"
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "ob_bit_stream.h"
+#include "ob_raw_decoder.h"
 
 namespace oceanbase
 {
@@ -456,7 +457,6 @@ int ObConstDecoder::nu_nn_operator(
   } else {
     int64_t dict_count = dict_decoder_.get_dict_header()->count_;
     const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
-    int64_t ref;
     int64_t row_id;
     if (meta_header_->const_ref_ == dict_count) {
       // Const is null all expection values are not null
@@ -469,16 +469,8 @@ int ObConstDecoder::nu_nn_operator(
           LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
         }
       }
-    } else {
-      for (int64_t pos = 0; OB_SUCC(ret) && pos < meta_header_->count_; ++pos) {
-        ref = reinterpret_cast<const uint8_t*>(meta_header_->payload_)[pos];
-        if (ref == dict_count) {
-          row_id = row_ids.at_(meta_header_->payload_ + meta_header_->count_, pos);
-          if (OB_FAIL(result_bitmap.set(row_id))) {
-            LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
-          }
-        }
-      }
+    } else if (OB_FAIL(traverse_refs_and_set_res(row_ids, dict_count, true, result_bitmap))) {
+      LOG_WARN("Failed to set null exceptions to result bitmap", K(ret), K(dict_count));
     }
     if (OB_SUCC(ret) && filter.get_op_type() == sql::WHITE_OP_NN) {
       if (OB_FAIL(result_bitmap.bit_not())) {
@@ -743,14 +735,37 @@ int ObConstDecoder::traverse_refs_and_set_res(
     ObBitmap &result_bitmap) const
 {
   int ret = OB_SUCCESS;
-  int64_t ref;
+  const int64_t count = meta_header_->count_;
+  const uint8_t *refs = reinterpret_cast<const uint8_t*>(meta_header_->payload_);
   int64_t row_id;
-  for (int64_t pos = 0; OB_SUCC(ret) && pos < meta_header_->count_; ++pos) {
-    ref = reinterpret_cast<const uint8_t*>(meta_header_->payload_)[pos];
-    if (ref == dict_ref) {
-      row_id = row_ids.at_(meta_header_->payload_ + meta_header_->count_, pos);
-      if (OB_FAIL(result_bitmap.set(row_id, flag))) {
-        LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(flag));
+  if (0 == count) {
+  } else if (raw_fix_fast_filter_funcs_inited) {
+    if (dict_ref > UINT8_MAX) {
+      // exception refs are stored in 1 byte, no exception matches
+    } else {
+      // Compare refs of all exceptions in batch, dispatched to SIMD kernel if possible
+      char exc_bitset_buf[sql::ObBitVector::memory_size(count)];
+      sql::ObBitVector *exc_bitset = sql::to_bit_vector(exc_bitset_buf);
+      exc_bitset->init(count);
+      fix_filter_func ref_eq_func = raw_fix_fast_filter_funcs[0][0][sql::WHITE_OP_EQ];
+      ref_eq_func(count, reinterpret_cast<const unsigned char *>(refs),
+                  static_cast<uint64_t>(dict_ref), *exc_bitset);
+      for (int64_t pos = 0; OB_SUCC(ret) && pos < count; ++pos) {
+        if (exc_bitset->at(pos)) {
+          row_id = row_ids.at_(meta_header_->payload_ + count, pos);
+          if (OB_FAIL(result_bitmap.set(row_id, flag))) {
+            LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(flag));
+          }
+        }
+      }
+    }
+  } else {
+    for (int64_t pos = 0; OB_SUCC(ret) && pos < count; ++pos) {
+      if (refs[pos] == dict_ref) {
+        row_id = row_ids.at_(meta_header_->payload_ + count, pos);
+        if (OB_FAIL(result_bitmap.set(row_id, flag))) {
+          LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(flag));
+        }
       }
     }
   }
@@ -17,6 +17,7 @@
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "ob_bit_stream.h"
 #include "ob_integer_array.h"
+#include "ob_raw_decoder.h"
 
 namespace oceanbase
 {
@@ -25,6 +26,35 @@ namespace blocksstable
 using namespace common;
 const ObColumnHeader::Type ObIntegerBaseDiffDecoder::type_;
 
+ObMultiDimArray_T<int_diff_fix_unpack_func, 4> int_diff_fix_unpack_funcs;
+
+bool init_int_diff_fix_unpack_simd_funcs();
+
+template <int32_t LEN_TAG>
+struct IntDiffFixUnpackArrayInit
+{
+  bool operator()()
+  {
+    int_diff_fix_unpack_funcs[LEN_TAG] = &(IntDiffFixUnpackFunc_T<LEN_TAG>::fix_unpack_func);
+    return true;
+  }
+};
+
+bool init_int_diff_fix_unpack_funcs()
+{
+  bool res = false;
+  res = ObNDArrayIniter<IntDiffFixUnpackArrayInit, 4>::apply();
+  // Dispatch simd version unpack funcs
+#if defined ( __x86_64__ )
+  if (is_avx512_valid()) {
+    res = init_int_diff_fix_unpack_simd_funcs();
+  }
+#endif
+  return res;
+}
+
+bool int_diff_fix_unpack_funcs_inited = init_int_diff_fix_unpack_funcs();
+
 int ObIntegerBaseDiffDecoder::decode(ObColumnDecoderCtx &ctx, common::ObObj &cell, const int64_t row_id,
     const ObBitStream &bs, const char *data, const int64_t len) const
 {
@@ -154,8 +184,40 @@ int ObIntegerBaseDiffDecoder::batch_get_bitpacked_values(
 
 #undef INT_DIFF_UNPACK_REFS
 
+// Unpack continuous fixed length deltas and add @base_ with the dispatched
+// (SIMD if possible) kernel, row_ids should be continuous and increasing
+int ObIntegerBaseDiffDecoder::batch_get_fixed_values(
+    const ObColumnDecoderCtx &ctx,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    const int64_t datum_len,
+    const int64_t data_offset,
+    common::ObDatum *datums) const
+{
+  int ret = OB_SUCCESS;
+  const unsigned char *delta_data = reinterpret_cast<const unsigned char *>(header_)
+      + ctx.col_header_->length_ + data_offset;
+  const int_diff_fix_unpack_func unpack_func
+      = int_diff_fix_unpack_funcs[get_value_len_tag_map()[header_->length_]];
+  const bool has_ext_val = ctx.has_extend_value();
+  uint64_t values[UNPACK_BATCH_SIZE];
+  for (int64_t batch_start = 0; batch_start < row_cap; batch_start += UNPACK_BATCH_SIZE) {
+    const int64_t batch_cnt = MIN(UNPACK_BATCH_SIZE, row_cap - batch_start);
+    unpack_func(delta_data, row_ids[batch_start], batch_cnt, base_, values);
+    for (int64_t i = 0; i < batch_cnt; ++i) {
+      ObDatum &datum = datums[batch_start + i];
+      if (has_ext_val && datum.is_null()) {
+        // Skip
+      } else {
+        MEMCPY(const_cast<char *>(datum.ptr_), &values[i], datum_len);
+        datum.pack_ = static_cast<uint32_t>(datum_len);
+      }
+    }
+  }
+  return ret;
+}
+
 // Internal call, not check parameters for performance
-// Potential optimization: SIMD batch add @base_ to packed delta values
 int ObIntegerBaseDiffDecoder::batch_decode(
     const ObColumnDecoderCtx &ctx,
     const ObIRowIndex* row_index,
@@ -193,9 +255,18 @@ int ObIntegerBaseDiffDecoder::batch_decode(
           ctx, row_ids, row_cap, datum_len, data_offset, datums))) {
         LOG_WARN("Failed to batch unpack delta values", K(ret), K(ctx));
       }
+    } else if (FALSE_IT(data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT)) {
+    } else if (int_diff_fix_unpack_funcs_inited
+        && row_cap > 1
+        && row_ids[row_cap - 1] - row_ids[0] == row_cap - 1
+        && is_fix_len_supported(header_->length_)) {
+      // Continuous rows, unpack deltas with batch kernel
+      if (OB_FAIL(batch_get_fixed_values(
+          ctx, row_ids, row_cap, datum_len, data_offset, datums))) {
+        LOG_WARN("Failed to batch unpack fixed delta values", K(ret), K(ctx));
+      }
     } else {
       // Fixed store data
-      data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
       int64_t row_id = 0;
       uint64_t value = 0;
       for (int64_t i = 0; i < row_cap; ++i) {
@@ -418,20 +489,28 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
         }
       } else {
         data_offset = (data_offset + CHAR_BIT - 1) / CHAR_BIT;
-        for (int64_t row_id = 0;
-            OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
-            ++row_id) {
-          if (exist_parent_filter && parent->can_skip_filter(row_id)) {
-          } else if (null_value_contained && result_bitmap.test(row_id)) {
-            if (OB_FAIL(result_bitmap.set(row_id, false))) {
-              LOG_WARN("Failed to set row with null object to false", K(ret));
-            }
-          } else {
-            MEMCPY(&delta_value, col_data + data_offset + row_id * cell_len, cell_len);
-            bool cmp_result = fp_int_cmp<uint64_t>(delta_value, param_delta_value, cmp_op_type);
-            if (cmp_result) {
-              if (OB_FAIL(result_bitmap.set(row_id))) {
-                LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
+        if (!null_value_contained && raw_fix_fast_filter_funcs_inited
+            && is_fix_len_supported(cell_len)) {
+          if (OB_FAIL(fast_comparison_operator(col_ctx, col_data + data_offset,
+              filter.get_op_type(), param_delta_value, result_bitmap))) {
+            LOG_WARN("Failed on fast comparison operator", K(ret), K(col_ctx));
+          }
+        } else {
+          for (int64_t row_id = 0;
+              OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+              ++row_id) {
+            if (exist_parent_filter && parent->can_skip_filter(row_id)) {
+            } else if (null_value_contained && result_bitmap.test(row_id)) {
+              if (OB_FAIL(result_bitmap.set(row_id, false))) {
+                LOG_WARN("Failed to set row with null object to false", K(ret));
+              }
+            } else {
+              MEMCPY(&delta_value, col_data + data_offset + row_id * cell_len, cell_len);
+              bool cmp_result = fp_int_cmp<uint64_t>(delta_value, param_delta_value, cmp_op_type);
+              if (cmp_result) {
+                if (OB_FAIL(result_bitmap.set(row_id))) {
+                  LOG_WARN("Failed to set result bitmap", K(ret), K(row_id), K(filter));
+                }
               }
             }
           }
@@ -442,6 +521,44 @@ int ObIntegerBaseDiffDecoder::comparison_operator(
   return ret;
 }
 
+int ObIntegerBaseDiffDecoder::fast_comparison_operator(
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* delta_data,
+    const sql::ObWhiteFilterOperatorType op_type,
+    const uint64_t param_delta_value,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const uint8_t cell_len = header_->length_;
+  const int64_t row_cnt = col_ctx.micro_block_header_->row_count_;
+  if (OB_UNLIKELY(row_cnt != result_bitmap.size() || NULL == delta_data
+      || op_type > sql::WHITE_OP_NE || !is_fix_len_supported(cell_len))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Filter pushdown operator: Invalid argument", K(ret), K(col_ctx), K(op_type), K(cell_len));
+  } else if (param_delta_value > INTEGER_MASK_TABLE[cell_len]) {
+    // Filter delta can not be stored in @cell_len bytes, larger than all stored deltas
+    if (sql::WHITE_OP_NE == op_type || sql::WHITE_OP_LT == op_type || sql::WHITE_OP_LE == op_type) {
+      if (OB_FAIL(result_bitmap.bit_not())) {
+        LOG_WARN("Failed to set result bitmap to all true", K(ret));
+      }
+    }
+  } else {
+    const int64_t size = sql::ObBitVector::memory_size(row_cnt);
+    // Use BitVector to set the result of filter here because the memory of ObBitMap is not continuous
+    char buf[size];
+    sql::ObBitVector *bit_vec = sql::to_bit_vector(buf);
+    bit_vec->reset(row_cnt);
+    // Deltas are always unsigned
+    fix_filter_func fast_filter_func = raw_fix_fast_filter_funcs
+        [0][get_value_len_tag_map()[cell_len]][op_type];
+    fast_filter_func(row_cnt, delta_data, param_delta_value, *bit_vec);
+    if (OB_FAIL(result_bitmap.load_blocks_from_array(reinterpret_cast<uint64_t *>(buf), row_cnt))) {
+      LOG_WARN("Failed to load bitmap from array on stack", K(ret), KP(buf), K(row_cnt));
+    }
+  }
+  return ret;
+}
+
 int ObIntegerBaseDiffDecoder::bt_operator(
     const sql::ObPushdownFilterExecutor *parent,
     const ObColumnDecoderCtx &col_ctx,
@@ -16,6 +16,7 @@
 
 #include "ob_icolumn_decoder.h"
 #include "ob_encoding_util.h"
+#include "ob_encoding_query_util.h"
 #include "ob_integer_base_diff_encoder.h"
 #include "ob_bit_stream.h"
 
@@ -73,6 +74,12 @@ public:
       const int64_t row_cap,
       int64_t &null_count) const override;
 private:
+  static const int64_t UNPACK_BATCH_SIZE = 256;
+  OB_INLINE static bool is_fix_len_supported(const int64_t len)
+  {
+    return 1 == len || 2 == len || 4 == len || 8 == len;
+  }
+
   int batch_get_bitpacked_values(
       const ObColumnDecoderCtx &ctx,
       const int64_t *row_ids,
@@ -81,6 +88,14 @@ private:
       const int64_t data_offset,
       common::ObDatum *datums) const;
 
+  int batch_get_fixed_values(
+      const ObColumnDecoderCtx &ctx,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      const int64_t datum_len,
+      const int64_t data_offset,
+      common::ObDatum *datums) const;
+
   template <typename T>
   inline int get_delta(const common::ObObj &cell, uint64_t &delta) const
   {
@@ -97,6 +112,14 @@ private:
       const sql::ObWhiteFilterExecutor &filter,
       ObBitmap &result_bitmap) const;
 
+  // No null value for fast comparison operator
+  int fast_comparison_operator(
+      const ObColumnDecoderCtx &col_ctx,
+      const unsigned char* delta_data,
+      const sql::ObWhiteFilterOperatorType op_type,
+      const uint64_t param_delta_value,
+      ObBitmap &result_bitmap) const;
+
   int bt_operator(
       const sql::ObPushdownFilterExecutor *parent,
       const ObColumnDecoderCtx &col_ctx,
@@ -168,6 +191,36 @@ OB_INLINE void ObIntegerBaseDiffDecoder::reuse()
   base_ = 0;
   */
 }
+
+typedef void (*int_diff_fix_unpack_func)(
+    const unsigned char *delta_data,
+    const int64_t row_start,
+    const int64_t row_cnt,
+    const uint64_t base,
+    uint64_t *values);
+
+// Unpack @row_cnt fixed length deltas start from @row_start and add @base to them
+template <int32_t LEN_TAG>
+struct IntDiffFixUnpackFunc_T
+{
+  static void fix_unpack_func(
+      const unsigned char *delta_data,
+      const int64_t row_start,
+      const int64_t row_cnt,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    typedef typename ObEncodingTypeInference<0, LEN_TAG>::Type DeltaType;
+    const DeltaType *deltas = reinterpret_cast<const DeltaType *>(delta_data) + row_start;
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      values[i] = base + deltas[i];
+    }
+  }
+};
+
+extern ObMultiDimArray_T<int_diff_fix_unpack_func, 4> int_diff_fix_unpack_funcs;
+extern bool int_diff_fix_unpack_funcs_inited;
+
 } // end namespace blocksstable
 } // end namespace oceanbase
 
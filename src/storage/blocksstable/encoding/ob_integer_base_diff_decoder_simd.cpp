@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_encoding_query_util.h"
+#include "ob_integer_base_diff_decoder.h"
+
+namespace oceanbase {
+namespace blocksstable {
+
+template <int32_t LEN_TAG>
+struct IntDiffFixUnpackAVX2Func_T : public IntDiffFixUnpackFunc_T<LEN_TAG>
+{};
+
+#if defined ( __AVX2__ )
+template <>
+struct IntDiffFixUnpackAVX2Func_T<0>
+{
+  // Unpack 1 byte deltas, 16 rows per loop
+  static void fix_unpack_func(
+      const unsigned char *delta_data,
+      const int64_t row_start,
+      const int64_t row_cnt,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    const uint8_t *deltas = reinterpret_cast<const uint8_t *>(delta_data) + row_start;
+    const __m256i base_vec = _mm256_set1_epi64x(static_cast<int64_t>(base));
+    int64_t i = 0;
+    for (; i + 16 <= row_cnt; i += 16) {
+      __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(deltas + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i),
+          _mm256_add_epi64(_mm256_cvtepu8_epi64(data_vec), base_vec));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i + 4),
+          _mm256_add_epi64(_mm256_cvtepu8_epi64(_mm_srli_si128(data_vec, 4)), base_vec));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i + 8),
+          _mm256_add_epi64(_mm256_cvtepu8_epi64(_mm_srli_si128(data_vec, 8)), base_vec));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i + 12),
+          _mm256_add_epi64(_mm256_cvtepu8_epi64(_mm_srli_si128(data_vec, 12)), base_vec));
+    }
+    for (; i < row_cnt; ++i) {
+      values[i] = base + deltas[i];
+    }
+  }
+};
+
+template <>
+struct IntDiffFixUnpackAVX2Func_T<1>
+{
+  // Unpack 2 byte deltas, 8 rows per loop
+  static void fix_unpack_func(
+      const unsigned char *delta_data,
+      const int64_t row_start,
+      const int64_t row_cnt,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    const uint16_t *deltas = reinterpret_cast<const uint16_t *>(delta_data) + row_start;
+    const __m256i base_vec = _mm256_set1_epi64x(static_cast<int64_t>(base));
+    int64_t i = 0;
+    for (; i + 8 <= row_cnt; i += 8) {
+      __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(deltas + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i),
+          _mm256_add_epi64(_mm256_cvtepu16_epi64(data_vec), base_vec));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i + 4),
+          _mm256_add_epi64(_mm256_cvtepu16_epi64(_mm_srli_si128(data_vec, 8)), base_vec));
+    }
+    for (; i < row_cnt; ++i) {
+      values[i] = base + deltas[i];
+    }
+  }
+};
+
+template <>
+struct IntDiffFixUnpackAVX2Func_T<2>
+{
+  // Unpack 4 byte deltas, 4 rows per loop
+  static void fix_unpack_func(
+      const unsigned char *delta_data,
+      const int64_t row_start,
+      const int64_t row_cnt,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    const uint32_t *deltas = reinterpret_cast<const uint32_t *>(delta_data) + row_start;
+    const __m256i base_vec = _mm256_set1_epi64x(static_cast<int64_t>(base));
+    int64_t i = 0;
+    for (; i + 4 <= row_cnt; i += 4) {
+      __m128i data_vec = _mm_loadu_si128(reinterpret_cast<const __m128i *>(deltas + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i),
+          _mm256_add_epi64(_mm256_cvtepu32_epi64(data_vec), base_vec));
+    }
+    for (; i < row_cnt; ++i) {
+      values[i] = base + deltas[i];
+    }
+  }
+};
+
+template <>
+struct IntDiffFixUnpackAVX2Func_T<3>
+{
+  // Add base to 8 byte deltas, 4 rows per loop
+  static void fix_unpack_func(
+      const unsigned char *delta_data,
+      const int64_t row_start,
+      const int64_t row_cnt,
+      const uint64_t base,
+      uint64_t *values)
+  {
+    const uint64_t *deltas = reinterpret_cast<const uint64_t *>(delta_data) + row_start;
+    const __m256i base_vec = _mm256_set1_epi64x(static_cast<int64_t>(base));
+    int64_t i = 0;
+    for (; i + 4 <= row_cnt; i += 4) {
+      __m256i data_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(deltas + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(values + i),
+          _mm256_add_epi64(data_vec, base_vec));
+    }
+    for (; i < row_cnt; ++i) {
+      values[i] = base + deltas[i];
+    }
+  }
+};
+#endif
+
+template <int32_t LEN_TAG>
+struct IntDiffFixUnpackAVX2ArrayInit
+{
+  bool operator()()
+  {
+    int_diff_fix_unpack_funcs[LEN_TAG] = &(IntDiffFixUnpackAVX2Func_T<LEN_TAG>::fix_unpack_func);
+    return true;
+  }
+};
+
+bool init_int_diff_fix_unpack_simd_funcs()
+{
+  return ObNDArrayIniter<IntDiffFixUnpackAVX2ArrayInit, 4>::apply();
+}
+
+} // end of namespace blocksstable
+} // end of namespace oceanbase
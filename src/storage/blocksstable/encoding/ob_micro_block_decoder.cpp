@@ -14,6 +14,7 @@
 #include "ob_micro_block_decoder.h"
 #include "share/rc/ob_tenant_base.h"
 #include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_aggregated_store.h"
 
 namespace oceanbase
 {
@@ -2152,6 +2153,24 @@ int ObMicroBlockDecoder::get_min_or_max(
   return ret;
 }
 
+int ObMicroBlockDecoder::get_aggregate_result(
+    const int32_t col_id,
+    const int64_t *row_ids,
+    const char **cell_datas,
+    const int64_t row_cap,
+    ObDatum *datum_buf,
+    storage::ObAggCell &agg_cell)
+{
+  int ret = OB_SUCCESS;
+  decoder_allocator_.reuse();
+  if (OB_FAIL(get_col_datums(col_id, row_ids, cell_datas, row_cap, datum_buf))) {
+    LOG_WARN("Failed to get col datums", K(ret), K(col_id), K(row_cap));
+  } else if (OB_FAIL(agg_cell.eval_batch(datum_buf, row_cap))) {
+    LOG_WARN("Failed to eval batch", K(ret), K(col_id), K(row_cap));
+  }
+  return ret;
+}
+
 int ObMicroBlockDecoder::get_col_datums(
     int32_t col_id,
     const int64_t *row_ids,
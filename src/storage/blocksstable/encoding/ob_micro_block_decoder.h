@@ -26,6 +26,7 @@ namespace oceanbase
 {
 namespace storage {
 struct PushdownFilterInfo;
+class ObAggCell;
 }
 namespace blocksstable
 {
@@ -270,6 +271,13 @@ public:
       const int64_t row_cap,
       ObDatum *datum_buf,
       ObMicroBlockAggInfo<ObDatum> &agg_info);
+  int get_aggregate_result(
+      const int32_t col_id,
+      const int64_t *row_ids,
+      const char **cell_datas,
+      const int64_t row_cap,
+      ObDatum *datum_buf,
+      storage::ObAggCell &agg_cell);
   virtual int64_t get_column_count() const override
   {
     OB_ASSERT(nullptr != header_);
@@ -585,6 +585,13 @@ int ObRawDecoder::pushdown_operator(
       }
       break;
     }
+    case sql::WHITE_OP_LI: {
+      if (OB_FAIL(like_operator(parent, col_ctx, col_data, row_index,
+                  filter, result_bitmap))) {
+        LOG_WARN("Failed on Like Operator", K(ret), K(col_ctx));
+      }
+      break;
+    }
     default: {
       ret = OB_NOT_SUPPORTED;
       LOG_WARN("Not supported operation type", K(ret), K(op_type));
@@ -859,6 +866,37 @@ int ObRawDecoder::in_operator(
   return ret;
 }
 
+// Match string in place, prefix pattern is compared by bytes without copying the cell
+int ObRawDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const unsigned char* col_data,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(filter.get_objs().count() != 2
+             || result_bitmap.size() != col_ctx.micro_block_header_->row_count_
+             || NULL == row_index)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Pushdown like operator: Invalid arguments", K(ret), K(filter.get_objs()));
+  } else if (ObStringSC != store_class_) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_DEBUG("Like operator only supported on string store class", K(ret), K_(store_class));
+  } else if (OB_FAIL(traverse_all_data(parent, col_ctx, row_index, col_data,
+                    filter, result_bitmap,
+                    [](const ObObj &cur_obj,
+                      const sql::ObWhiteFilterExecutor &filter,
+                      bool &result) -> int {
+                      result = filter.like_match(cur_obj.get_string());
+                      return OB_SUCCESS;
+                    }))) {
+    LOG_WARN("Failed to traverse all data in micro block", K(ret));
+  }
+  return ret;
+}
+
 /**
  *  Function to traverse all row data with raw encoding, regardless of column is fixed length
  *  or var lengthand run lambda function for every row element.
@@ -16,6 +16,7 @@
 #include "ob_dict_decoder.h"
 #include "storage/blocksstable/ob_block_sstable_struct.h"
 #include "ob_bit_stream.h"
+#include "ob_raw_decoder.h"
 
 namespace oceanbase
 {
@@ -23,6 +24,30 @@ namespace blocksstable
 {
 using namespace common;
 const ObColumnHeader::Type ObRLEDecoder::type_;
+
+// Set or clear bits in [start, end) of continuous bit words
+OB_INLINE static void fill_bit_words(
+    uint64_t *words,
+    const int64_t start,
+    const int64_t end,
+    const bool flag)
+{
+  const int64_t begin_idx = start >> 6;
+  const int64_t end_idx = (end - 1) >> 6;
+  const uint64_t begin_mask = UINT64_MAX << (start & 63);
+  const uint64_t end_mask = UINT64_MAX >> (63 - ((end - 1) & 63));
+  if (begin_idx == end_idx) {
+    const uint64_t mask = begin_mask & end_mask;
+    words[begin_idx] = flag ? (words[begin_idx] | mask) : (words[begin_idx] & ~mask);
+  } else {
+    words[begin_idx] = flag ? (words[begin_idx] | begin_mask) : (words[begin_idx] & ~begin_mask);
+    if (end_idx - begin_idx > 1) {
+      MEMSET(words + begin_idx + 1, flag ? 0xFF : 0, (end_idx - begin_idx - 1) * sizeof(uint64_t));
+    }
+    words[end_idx] = flag ? (words[end_idx] | end_mask) : (words[end_idx] & ~end_mask);
+  }
+}
+
 int ObRLEDecoder::decode(ObColumnDecoderCtx &ctx, ObObj &cell, const int64_t row_id,
     const ObBitStream &bs,
     const char *data, const int64_t len) const
@@ -404,26 +429,39 @@ int ObRLEDecoder::cmp_ref_and_set_res(
 {
   UNUSED(parent);
   int ret = OB_SUCCESS;
-  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
-  const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(meta_header_->ref_byte_);
-  int64_t row_id;
-  int64_t next_row_id;
-  int64_t ref;
-  for (int64_t i = 0; OB_SUCC(ret) && i < meta_header_->count_ ; ++i) {
-    ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
-    if (fp_int_cmp<int64_t>(ref, dict_ref, cmp_op)
-        && OB_LIKELY(ref < dict_decoder_.get_dict_header()->count_ || FP_INT_OP_EQ == cmp_op)) {
-      row_id = row_ids.at_(meta_header_->payload_, i);
-      next_row_id = i != meta_header_->count_ - 1
-                          ? row_ids.at_(meta_header_->payload_, i + 1)
-                          : col_ctx.micro_block_header_->row_count_;
-      for (int64_t idx = row_id; OB_SUCC(ret) && idx < next_row_id; ++idx) {
-        if (OB_FAIL(result_bitmap.set(idx, flag))) {
-          LOG_WARN("Failed to set result_bitmap", K(ret), K(row_id), K(next_row_id), K(idx));
-        }
+  const int64_t run_cnt = meta_header_->count_;
+  const int64_t ref_byte = meta_header_->ref_byte_;
+  char run_bitset_buf[sql::ObBitVector::memory_size(run_cnt)];
+  sql::ObBitVector *run_bitset = sql::to_bit_vector(run_bitset_buf);
+  run_bitset->init(run_cnt);
+  if (FP_INT_OP_EQ == cmp_op && raw_fix_fast_filter_funcs_inited
+      && (1 == ref_byte || 2 == ref_byte || 4 == ref_byte || 8 == ref_byte)) {
+    if (static_cast<uint64_t>(dict_ref) > INTEGER_MASK_TABLE[ref_byte]) {
+      // dict_ref can not be stored in @ref_byte, no run matches
+    } else {
+      // Compare refs of all runs in batch, dispatched to SIMD kernel if possible
+      fix_filter_func ref_eq_func = raw_fix_fast_filter_funcs
+          [0][get_value_len_tag_map()[ref_byte]][sql::WHITE_OP_EQ];
+      ref_eq_func(run_cnt,
+                  reinterpret_cast<const unsigned char *>(meta_header_->payload_ + ref_offset_),
+                  static_cast<uint64_t>(dict_ref),
+                  *run_bitset);
+    }
+  } else {
+    const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(ref_byte);
+    const int64_t dict_count = dict_decoder_.get_dict_header()->count_;
+    int64_t ref;
+    for (int64_t i = 0; i < run_cnt; ++i) {
+      ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
+      if (fp_int_cmp<int64_t>(ref, dict_ref, cmp_op)
+          && OB_LIKELY(ref < dict_count || FP_INT_OP_EQ == cmp_op)) {
+        run_bitset->set(i);
       }
     }
   }
+  if (OB_FAIL(set_runs_with_bitset(col_ctx, run_bitset, flag, result_bitmap))) {
+    LOG_WARN("Failed to set result bitmap with run bitset", K(ret), K(dict_ref), K(flag));
+  }
   return ret;
 }
 
@@ -435,21 +473,49 @@ int ObRLEDecoder::set_res_with_bitset(
 {
   UNUSED(parent);
   int ret = OB_SUCCESS;
-  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
   const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(meta_header_->ref_byte_);
+  const int64_t run_cnt = meta_header_->count_;
+  char run_bitset_buf[sql::ObBitVector::memory_size(run_cnt)];
+  sql::ObBitVector *run_bitset = sql::to_bit_vector(run_bitset_buf);
+  run_bitset->init(run_cnt);
+  for (int64_t i = 0; i < run_cnt; ++i) {
+    if (ref_bitset->exist(refs.at_(meta_header_->payload_ + ref_offset_, i))) {
+      run_bitset->set(i);
+    }
+  }
+  if (OB_FAIL(set_runs_with_bitset(col_ctx, run_bitset, true, result_bitmap))) {
+    LOG_WARN("Failed to set result bitmap with run bitset", K(ret));
+  }
+  return ret;
+}
+
+int ObRLEDecoder::set_runs_with_bitset(
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObBitVector *run_bitset,
+    const bool flag,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  const ObIntArrayFuncTable &row_ids = ObIntArrayFuncTable::instance(meta_header_->row_id_byte_);
+  const int64_t run_cnt = meta_header_->count_;
+  const int64_t row_cnt = col_ctx.micro_block_header_->row_count_;
+  void *bit_ptr = nullptr;
+  // Fill whole runs by words if the result bitmap is continuous
+  const bool fill_by_words = result_bitmap.get_bit_set(0, row_cnt, bit_ptr) && nullptr != bit_ptr;
   int64_t row_id;
   int64_t next_row_id;
-  int64_t ref;
-  for (int64_t i = 0; OB_SUCC(ret) && i < meta_header_->count_ ; ++i) {
-    ref = refs.at_(meta_header_->payload_ + ref_offset_, i);
-    if (ref_bitset->exist(ref)) {
+  for (int64_t i = 0; OB_SUCC(ret) && i < run_cnt; ++i) {
+    if (run_bitset->at(i)) {
       row_id = row_ids.at_(meta_header_->payload_, i);
-      next_row_id = i != meta_header_->count_ - 1
-                          ? row_ids.at_(meta_header_->payload_, i + 1)
-                          : col_ctx.micro_block_header_->row_count_;
-      for (int64_t idx = row_id; OB_SUCC(ret) && idx < next_row_id; ++idx) {
-        if (OB_FAIL(result_bitmap.set(idx))) {
-          LOG_WARN("Failed to set result_bitmap", K(ret), K(row_id), K(next_row_id), K(idx));
+      next_row_id = i != run_cnt - 1 ? row_ids.at_(meta_header_->payload_, i + 1) : row_cnt;
+      if (row_id >= next_row_id) {
+      } else if (fill_by_words) {
+        fill_bit_words(static_cast<uint64_t *>(bit_ptr), row_id, next_row_id, flag);
+      } else {
+        for (int64_t idx = row_id; OB_SUCC(ret) && idx < next_row_id; ++idx) {
+          if (OB_FAIL(result_bitmap.set(idx, flag))) {
+            LOG_WARN("Failed to set result_bitmap", K(ret), K(row_id), K(next_row_id), K(idx));
+          }
         }
       }
     }
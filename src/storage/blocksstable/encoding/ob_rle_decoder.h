@@ -122,6 +122,13 @@ private:
       const sql::ObBitVector *ref_bitset,
       ObBitmap &result_bitmap) const;
 
+  // Set rows of the runs marked in @run_bitset to @flag
+  int set_runs_with_bitset(
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObBitVector *run_bitset,
+      const bool flag,
+      ObBitmap &result_bitmap) const;
+
   int extract_ref_and_null_count(
       const int64_t *row_ids,
       const int64_t row_cap,
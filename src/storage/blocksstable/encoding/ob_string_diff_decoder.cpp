@@ -25,6 +25,26 @@ namespace blocksstable
 using namespace common;
 const ObColumnHeader::Type ObStringDiffDecoder::type_;
 
+string_diff_short_batch_func string_diff_short_batch_decode_func = nullptr;
+
+bool init_string_diff_short_batch_simd_func();
+
+bool init_string_diff_short_batch_func()
+{
+  bool res = false;
+  string_diff_short_batch_decode_func = &StringDiffShortBatchFunc_T::short_batch_func;
+  res = true;
+  // Dispatch simd version batch decode func
+#if defined ( __x86_64__ )
+  if (is_avx512_valid()) {
+    res = init_string_diff_short_batch_simd_func();
+  }
+#endif
+  return res;
+}
+
+bool string_diff_short_batch_func_inited = init_string_diff_short_batch_func();
+
 ObStringDiffDecoder::ObStringDiffDecoder() : header_(NULL)
 {
 }
@@ -141,6 +161,36 @@ int ObStringDiffDecoder::update_pointer(const char *old_block, const char *cur_b
   return ret;
 }
 
+bool ObStringDiffDecoder::can_batch_decode_short_string(const ObColumnDecoderCtx &ctx) const
+{
+  return string_diff_short_batch_func_inited
+      && ctx.is_fix_length()
+      && !header_->is_hex_packing()
+      && header_->string_size_ <= SHORT_STRING_SIZE
+      && header_->length_ <= SHORT_CELL_SIZE;
+}
+
+// Place common bytes into @tmpl, and positions of diff bytes in cell into @shuffle_idx
+void ObStringDiffDecoder::build_short_string_template(char *tmpl, uint8_t *shuffle_idx) const
+{
+  MEMSET(tmpl, 0, SHORT_STRING_SIZE);
+  MEMSET(shuffle_idx, 0x80, SHORT_STRING_SIZE);
+  const char *common_data = header_->common_data();
+  int64_t common_pos = 0;
+  int64_t diff_pos = 0;
+  int64_t str_pos = 0;
+  for (int64_t i = 0; i < header_->diff_desc_cnt_; ++i) {
+    const ObStringDiffHeader::DiffDesc &desc = header_->diff_descs_[i];
+    for (int64_t k = 0; k < desc.count_ && str_pos < SHORT_STRING_SIZE; ++k, ++str_pos) {
+      if (0 != desc.diff_) {
+        shuffle_idx[str_pos] = static_cast<uint8_t>(diff_pos++);
+      } else {
+        tmpl[str_pos] = common_data[common_pos++];
+      }
+    }
+  }
+}
+
 // Internal call, not check parameters for performance
 int ObStringDiffDecoder::batch_decode(
     const ObColumnDecoderCtx &ctx,
@@ -175,6 +225,7 @@ int ObStringDiffDecoder::batch_decode(
 
     // Fill string data
     const uint16_t string_size = header_->string_size_;
+    const bool short_string_batch = can_batch_decode_short_string(ctx);
     const static uint16_t min_buf_size = 128;
     const int64_t buf_size = std::max(string_size, min_buf_size);
     char *buf = nullptr;
@@ -182,7 +233,7 @@ int ObStringDiffDecoder::batch_decode(
     } else if (OB_ISNULL(buf = static_cast<char *>(ctx.allocator_->alloc(buf_size * row_cap)))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       LOG_WARN("Failed to allocate memory", K(ret), K(buf_size), K(row_cap));
-    } else {
+    } else if (!short_string_batch) {
       for (int64_t i = 0; i < row_cap; ++i) {
         header_->copy_string(ObStringDiffHeader::LeftToRight(), std::logical_not<uint8_t>(),
             header_->common_data(), buf + i * buf_size);
@@ -190,6 +241,13 @@ int ObStringDiffDecoder::batch_decode(
     }
 
     if (OB_FAIL(ret)) {
+    } else if (short_string_batch) {
+      char tmpl[SHORT_STRING_SIZE];
+      uint8_t shuffle_idx[SHORT_STRING_SIZE];
+      build_short_string_template(tmpl, shuffle_idx);
+      string_diff_short_batch_decode_func(tmpl, shuffle_idx, col_data + data_offset,
+          header_->length_, string_size, row_ids, row_cap, ctx.has_extend_value(),
+          buf_size, buf, datums);
     } else if (ctx.is_fix_length()) {
       int64_t row_id = 0;
       const unsigned char *cell_data = nullptr;
@@ -57,10 +57,67 @@ public:
   virtual ObColumnHeader::Type get_type() const { return type_; }
 
   bool is_inited() const { return NULL != header_; }
+
+  // short strings are batch decoded by shuffling cell bytes into a template
+  static const int64_t SHORT_STRING_SIZE = 32;
+  static const int64_t SHORT_CELL_SIZE = 16;
+private:
+  bool can_batch_decode_short_string(const ObColumnDecoderCtx &ctx) const;
+  void build_short_string_template(char *tmpl, uint8_t *shuffle_idx) const;
 private:
   const ObStringDiffHeader *header_;
 };
 
+// Decode fixed length cells of short strings:
+//   string[i] = shuffle_idx[i] & 0x80 ? tmpl[i] : cell[shuffle_idx[i]]
+// @tmpl and @shuffle_idx are SHORT_STRING_SIZE bytes, @buf_size is no less than SHORT_STRING_SIZE
+typedef void (*string_diff_short_batch_func)(
+    const char *tmpl,
+    const uint8_t *shuffle_idx,
+    const unsigned char *col_data,
+    const int64_t cell_len,
+    const int64_t string_size,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    const bool has_null,
+    const int64_t buf_size,
+    char *buf,
+    common::ObDatum *datums);
+
+struct StringDiffShortBatchFunc_T
+{
+  static void short_batch_func(
+      const char *tmpl,
+      const uint8_t *shuffle_idx,
+      const unsigned char *col_data,
+      const int64_t cell_len,
+      const int64_t string_size,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      const bool has_null,
+      const int64_t buf_size,
+      char *buf,
+      common::ObDatum *datums)
+  {
+    for (int64_t i = 0; i < row_cap; ++i) {
+      if (has_null && datums[i].is_null()) {
+        // Skip
+      } else {
+        const unsigned char *cell = col_data + row_ids[i] * cell_len;
+        char *str_ptr = buf + i * buf_size;
+        for (int64_t j = 0; j < string_size; ++j) {
+          str_ptr[j] = (shuffle_idx[j] & 0x80) ? tmpl[j] : static_cast<char>(cell[shuffle_idx[j]]);
+        }
+        datums[i].pack_ = static_cast<uint32_t>(string_size);
+        datums[i].ptr_ = str_ptr;
+      }
+    }
+  }
+};
+
+extern string_diff_short_batch_func string_diff_short_batch_decode_func;
+extern bool string_diff_short_batch_func_inited;
+
 OB_INLINE int ObStringDiffDecoder::init(
     const ObMicroBlockHeader &micro_block_header,
     const ObColumnHeader &column_header,
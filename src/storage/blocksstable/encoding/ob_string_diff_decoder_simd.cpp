@@ -0,0 +1,68 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_encoding_query_util.h"
+#include "ob_string_diff_decoder.h"
+
+namespace oceanbase {
+namespace blocksstable {
+
+struct StringDiffShortBatchAVX2Func_T : public StringDiffShortBatchFunc_T
+{
+#if defined ( __AVX2__ )
+  // Shuffle diff bytes of cell into both 128 bit lanes and merge with template,
+  // a whole short string is built with one 256 bit store
+  static void short_batch_func(
+      const char *tmpl,
+      const uint8_t *shuffle_idx,
+      const unsigned char *col_data,
+      const int64_t cell_len,
+      const int64_t string_size,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      const bool has_null,
+      const int64_t buf_size,
+      char *buf,
+      common::ObDatum *datums)
+  {
+    const __m256i tmpl_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(tmpl));
+    const __m256i idx_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(shuffle_idx));
+    unsigned char cell[ObStringDiffDecoder::SHORT_CELL_SIZE] = {0};
+    for (int64_t i = 0; i < row_cap; ++i) {
+      if (has_null && datums[i].is_null()) {
+        // Skip
+      } else {
+        char *str_ptr = buf + i * buf_size;
+        // Copy cell out to avoid reading beyond the end of column data
+        MEMCPY(cell, col_data + row_ids[i] * cell_len, cell_len);
+        __m256i cell_vec = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(cell)));
+        __m256i str_vec = _mm256_or_si256(tmpl_vec, _mm256_shuffle_epi8(cell_vec, idx_vec));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(str_ptr), str_vec);
+        datums[i].pack_ = static_cast<uint32_t>(string_size);
+        datums[i].ptr_ = str_ptr;
+      }
+    }
+  }
+#endif
+};
+
+bool init_string_diff_short_batch_simd_func()
+{
+  string_diff_short_batch_decode_func = &StringDiffShortBatchAVX2Func_T::short_batch_func;
+  return true;
+}
+
+} // end of namespace blocksstable
+} // end of namespace oceanbase
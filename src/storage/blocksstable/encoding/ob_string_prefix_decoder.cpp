@@ -247,5 +247,154 @@ int ObStringPrefixDecoder::get_null_count(
   return ret;
 }
 
+/**
+ * Only LIKE operator is supported on string prefix encoding, other operators retrograde to
+ * row-wise decode and compare.
+ */
+int ObStringPrefixDecoder::pushdown_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const sql::ObWhiteFilterExecutor &filter,
+    const char* meta_data,
+    const ObIRowIndex* row_index,
+    ObBitmap &result_bitmap) const
+{
+  UNUSED(meta_data);
+  int ret = OB_SUCCESS;
+  const sql::ObWhiteFilterOperatorType op_type = filter.get_op_type();
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("StringPrefix decoder is not inited", K(ret));
+  } else if (OB_UNLIKELY(op_type >= sql::WHITE_OP_MAX
+                         || NULL == row_index
+                         || result_bitmap.size() != col_ctx.micro_block_header_->row_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for pushed down white filter", K(ret), K(op_type),
+             KP(row_index), K(result_bitmap.size()));
+  } else {
+    switch (op_type) {
+      case sql::WHITE_OP_LI: {
+        if (OB_FAIL(like_operator(parent, col_ctx, row_index, filter, result_bitmap))) {
+          LOG_WARN("Failed to run LIKE operator", K(ret), K(col_ctx));
+        }
+        break;
+      }
+      default: {
+        ret = OB_NOT_SUPPORTED;
+      }
+    }
+  }
+  return ret;
+}
+
+/**
+ * For prefix pattern, the shared prefix in meta is compared first and only the
+ * remaining bytes are compared with (or unpacked from) the cell, without building the string.
+ */
+int ObStringPrefixDecoder::like_operator(
+    const sql::ObPushdownFilterExecutor *parent,
+    const ObColumnDecoderCtx &col_ctx,
+    const ObIRowIndex* row_index,
+    const sql::ObWhiteFilterExecutor &filter,
+    ObBitmap &result_bitmap) const
+{
+  int ret = OB_SUCCESS;
+  ObIntegerArrayGenerator meta_gen;
+  char *buf = nullptr;
+  const bool is_prefix_like = filter.is_prefix_like();
+  const ObString &like_prefix = filter.get_like_prefix();
+  if (OB_UNLIKELY(filter.get_objs().count() != 2 || filter.null_param_contained())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument for LIKE operator", K(ret), K(filter));
+  } else if (OB_FAIL(meta_gen.init(meta_data_, meta_header_->prefix_index_byte_))) {
+    LOG_WARN("Failed to init integer array generator", K(ret), KP_(meta_data),
+        "Prefix index byte", meta_header_->prefix_index_byte_);
+  } else if (!is_prefix_like) {
+    const static uint32_t min_buf_size = 128;
+    const int64_t buf_size = std::max(meta_header_->max_string_size_, min_buf_size);
+    if (OB_ISNULL(buf = static_cast<char *>(col_ctx.allocator_->alloc(buf_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Failed to allocate memory", K(ret), K(buf_size));
+    }
+  }
+
+  if (OB_SUCC(ret)) {
+    const char *var_data = meta_data_
+        + (meta_header_->count_ - 1) * meta_header_->prefix_index_byte_;
+    const char *row_data = nullptr;
+    int64_t row_len = 0;
+    const char *cell_data = nullptr;
+    int64_t cell_len = 0;
+    for (int64_t row_id = 0;
+         OB_SUCC(ret) && row_id < col_ctx.micro_block_header_->row_count_;
+         ++row_id) {
+      uint64_t ext_val = STORED_NOT_EXT;
+      bool is_match = false;
+      if (nullptr != parent && parent->can_skip_filter(row_id)) {
+        continue;
+      } else if (OB_FAIL(locate_row_data(col_ctx, row_index, row_id, row_data, row_len))) {
+        LOG_WARN("Failed to locate row data", K(ret), K(row_id));
+      } else if (col_ctx.has_extend_value() && OB_FAIL(ObBitStream::get(
+          reinterpret_cast<const unsigned char *>(row_data),
+          col_ctx.col_header_->extend_value_index_,
+          col_ctx.micro_block_header_->extend_value_bit_,
+          ext_val))) {
+        LOG_WARN("Failed to get extend value", K(ret), K(row_id), K(col_ctx));
+      } else if (STORED_NOT_EXT != ext_val) {
+        // null value never matches
+      } else if (OB_FAIL(ObRawDecoder::locate_cell_data(cell_data, cell_len, row_data, row_len,
+          *col_ctx.micro_block_header_, *col_ctx.col_header_, *meta_header_))) {
+        LOG_WARN("Failed to locate cell data", K(ret), K(row_id), K(col_ctx));
+      } else {
+        const ObStringPrefixCellHeader *cell_header =
+            reinterpret_cast<const ObStringPrefixCellHeader *>(cell_data);
+        int64_t offset = 0;
+        if (0 != cell_header->get_ref()) {
+          offset = meta_gen.get_array().at(cell_header->get_ref() - 1);
+        }
+        const char *prefix_str = var_data + offset;
+        const int64_t prefix_len = cell_header->len_;
+        cell_data += sizeof(ObStringPrefixCellHeader);
+        cell_len -= sizeof(ObStringPrefixCellHeader);
+        const int64_t suffix_len = meta_header_->is_hex_packing()
+            ? cell_len * 2 - cell_header->get_odd() : cell_len;
+        if (is_prefix_like) {
+          const int64_t pattern_len = like_prefix.length();
+          if (pattern_len > prefix_len + suffix_len) {
+          } else if (0 != MEMCMP(prefix_str, like_prefix.ptr(), MIN(pattern_len, prefix_len))) {
+          } else if (pattern_len <= prefix_len) {
+            is_match = true;
+          } else if (meta_header_->is_hex_packing()) {
+            ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
+                reinterpret_cast<const unsigned char *>(cell_data));
+            is_match = true;
+            for (int64_t i = prefix_len; is_match && i < pattern_len; ++i) {
+              is_match = (static_cast<char>(unpacker.unpack()) == like_prefix.ptr()[i]);
+            }
+          } else {
+            is_match = (0 == MEMCMP(cell_data, like_prefix.ptr() + prefix_len, pattern_len - prefix_len));
+          }
+        } else {
+          MEMCPY(buf, prefix_str, prefix_len);
+          if (meta_header_->is_hex_packing()) {
+            ObHexStringUnpacker unpacker(meta_header_->hex_char_array_,
+                reinterpret_cast<const unsigned char *>(cell_data));
+            for (int64_t i = prefix_len; i < prefix_len + suffix_len; ++i) {
+              buf[i] = static_cast<char>(unpacker.unpack());
+            }
+          } else {
+            MEMCPY(buf + prefix_len, cell_data, cell_len);
+          }
+          is_match = filter.like_match(ObString(static_cast<int32_t>(prefix_len + suffix_len), buf));
+        }
+      }
+      if (OB_SUCC(ret) && is_match && OB_FAIL(result_bitmap.set(row_id))) {
+        LOG_WARN("Failed to set result bitmap", K(ret), K(row_id));
+      }
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
@@ -62,6 +62,21 @@ public:
       const int64_t *row_ids,
       const int64_t row_cap,
       int64_t &null_count) const override;
+
+  virtual int pushdown_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const sql::ObWhiteFilterExecutor &filter,
+      const char* meta_data,
+      const ObIRowIndex* row_index,
+      ObBitmap &result_bitmap) const override;
+private:
+  int like_operator(
+      const sql::ObPushdownFilterExecutor *parent,
+      const ObColumnDecoderCtx &col_ctx,
+      const ObIRowIndex* row_index,
+      const sql::ObWhiteFilterExecutor &filter,
+      ObBitmap &result_bitmap) const;
 private:
   const ObStringPrefixMetaHeader *meta_header_;
   const char *meta_data_;
@@ -195,6 +195,16 @@ int ObIMicroBlockReader::filter_white_filter(
         }
         break;
       }
+      case sql::WHITE_OP_LI: {
+        if (filter.null_param_contained() || obj.is_null()) {
+        } else if (OB_UNLIKELY(!obj.is_string_type())) {
+          ret = OB_INVALID_ARGUMENT;
+          LOG_WARN("Invalid object type for like operator", K(ret), K(obj));
+        } else if (filter.like_match(obj.get_string())) {
+          filtered = false;
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Unexpected filter pushdown operation type", K(ret), K(op_type));
@@ -49,6 +49,8 @@ void ObMicroBlockDesc::reset()
   has_lob_out_row_ = false;
   original_size_ = 0;
   is_last_row_last_flag_ = false;
+  agg_row_buf_ = nullptr;
+  agg_buf_size_ = 0;
 }
 
  /**
@@ -48,6 +48,8 @@ struct ObMicroBlockDesc
   bool has_string_out_row_;
   bool has_lob_out_row_;
   bool is_last_row_last_flag_;
+  const char *agg_row_buf_; // skip index aggregated row, null if not pre-aggregated
+  int64_t agg_buf_size_;
 
   ObMicroBlockDesc() { reset(); }
   bool is_valid() const;
@@ -72,6 +74,8 @@ struct ObMicroBlockDesc
       K_(has_string_out_row),
       K_(has_lob_out_row),
       K_(is_last_row_last_flag),
+      KP_(agg_row_buf),
+      K_(agg_buf_size),
       K_(original_size));
 };
 enum MICRO_BLOCK_MERGE_VERIFY_LEVEL
@@ -0,0 +1,270 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_index_block_aggregator.h"
+#include "ob_macro_block.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+void ObSkipIndexAggregator::ColAggregator::reset()
+{
+  cmp_func_ = nullptr;
+  can_agg_min_max_ = false;
+  reuse();
+}
+
+void ObSkipIndexAggregator::ColAggregator::reuse()
+{
+  is_valid_ = can_agg_min_max_;
+  has_value_ = false;
+  null_count_ = 0;
+  min_.set_null();
+  max_.set_null();
+}
+
+void ObSkipIndexAggregator::ColAggregator::copy_datum(const ObDatum &src, char *buf, ObDatum &dst)
+{
+  MEMCPY(buf, src.ptr_, src.len_);
+  dst.set_string(buf, src.len_);
+}
+
+int ObSkipIndexAggregator::ColAggregator::eval(const ObStorageDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (datum.is_null()) {
+    ++null_count_;
+  } else if (!is_valid_) {
+  } else if (datum.is_nop() || datum.is_ext() || datum.is_outrow()
+      || datum.len_ > MAX_SKIP_INDEX_VALUE_LEN) {
+    is_valid_ = false;
+  } else if (!has_value_) {
+    copy_datum(datum, min_buf_, min_);
+    copy_datum(datum, max_buf_, max_);
+    has_value_ = true;
+  } else {
+    int cmp_ret = 0;
+    if (OB_FAIL(cmp_func_(datum, min_, cmp_ret))) {
+      LOG_WARN("Fail to compare with min datum", K(ret), K(datum), K_(min));
+    } else if (cmp_ret < 0) {
+      copy_datum(datum, min_buf_, min_);
+    } else if (OB_FAIL(cmp_func_(datum, max_, cmp_ret))) {
+      LOG_WARN("Fail to compare with max datum", K(ret), K(datum), K_(max));
+    } else if (cmp_ret > 0) {
+      copy_datum(datum, max_buf_, max_);
+    }
+  }
+  return ret;
+}
+
+ObSkipIndexAggregator::ObSkipIndexAggregator()
+  : is_inited_(false),
+    col_cnt_(0),
+    row_count_(0),
+    col_aggs_()
+{
+}
+
+void ObSkipIndexAggregator::reset()
+{
+  is_inited_ = false;
+  col_cnt_ = 0;
+  row_count_ = 0;
+  for (int64_t i = 0; i < MAX_SKIP_INDEX_COL_CNT; ++i) {
+    col_aggs_[i].reset();
+  }
+}
+
+void ObSkipIndexAggregator::reuse()
+{
+  row_count_ = 0;
+  for (int64_t i = 0; i < col_cnt_; ++i) {
+    col_aggs_[i].reuse();
+  }
+}
+
+int ObSkipIndexAggregator::init(const ObDataStoreDesc &data_store_desc)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("Skip index aggregator init twice", K(ret));
+  } else if (OB_UNLIKELY(!data_store_desc.is_valid() || !data_store_desc.is_major_merge())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid data store desc for skip index", K(ret), K(data_store_desc));
+  } else {
+    const ObIArray<share::schema::ObColDesc> &col_descs = data_store_desc.get_full_stored_col_descs();
+    const int64_t trans_version_col_idx = data_store_desc.schema_rowkey_col_cnt_;
+    const int64_t sql_sequence_col_idx = data_store_desc.schema_rowkey_col_cnt_ + 1;
+    col_cnt_ = MIN(col_descs.count(), MAX_SKIP_INDEX_COL_CNT);
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      const ObObjMeta &col_type = col_descs.at(i).col_type_;
+      ColAggregator &col_agg = col_aggs_[i];
+      col_agg.reset();
+      if (trans_version_col_idx == i || sql_sequence_col_idx == i || is_lob_storage(col_type.get_type())) {
+        // no min/max for multi-version columns and lob columns, null count only
+      } else {
+        sql::ObExprBasicFuncs *basic_funcs = ObDatumFuncs::get_basic_func(col_type.get_type(),
+                                                                          col_type.get_collation_type(),
+                                                                          col_type.get_scale(),
+                                                                          lib::is_oracle_mode(),
+                                                                          false /*has_lob_header*/);
+        if (nullptr != basic_funcs && nullptr != basic_funcs->null_first_cmp_) {
+          col_agg.cmp_func_ = basic_funcs->null_first_cmp_;
+          col_agg.can_agg_min_max_ = true;
+        }
+      }
+      col_agg.reuse();
+    }
+    if (OB_SUCC(ret)) {
+      row_count_ = 0;
+      is_inited_ = true;
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::eval(const ObDatumRow &row)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Skip index aggregator not init", K(ret));
+  } else if (OB_UNLIKELY(row.get_column_count() < col_cnt_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Unexpected column count of row", K(ret), K(row), K_(col_cnt));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_cnt_; ++i) {
+      if (OB_FAIL(col_aggs_[i].eval(row.storage_datums_[i]))) {
+        LOG_WARN("Fail to eval skip index column", K(ret), K(i), K(row));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ++row_count_;
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexAggregator::get_aggregated_row(const char *&buf, int64_t &size)
+{
+  int ret = OB_SUCCESS;
+  buf = nullptr;
+  size = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Skip index aggregator not init", K(ret));
+  } else if (0 == row_count_) {
+    // empty micro block, no aggregated row
+  } else {
+    ObAggRowHeader header;
+    int64_t pos = sizeof(ObAggRowHeader) + col_cnt_ * sizeof(ObAggColMeta);
+    for (int64_t i = 0; i < col_cnt_; ++i) {
+      const ColAggregator &col_agg = col_aggs_[i];
+      ObAggColMeta col_meta;
+      col_meta.null_count_ = static_cast<uint32_t>(col_agg.null_count_);
+      if (col_agg.is_valid_ && col_agg.has_value_) {
+        col_meta.min_len_ = static_cast<uint16_t>(col_agg.min_.len_);
+        col_meta.max_len_ = static_cast<uint16_t>(col_agg.max_.len_);
+        MEMCPY(agg_row_buf_ + pos, col_agg.min_.ptr_, col_agg.min_.len_);
+        pos += col_agg.min_.len_;
+        MEMCPY(agg_row_buf_ + pos, col_agg.max_.ptr_, col_agg.max_.len_);
+        pos += col_agg.max_.len_;
+      }
+      MEMCPY(agg_row_buf_ + sizeof(ObAggRowHeader) + i * sizeof(ObAggColMeta), &col_meta, sizeof(ObAggColMeta));
+    }
+    header.version_ = ObAggRowHeader::AGG_ROW_HEADER_VERSION;
+    header.col_cnt_ = static_cast<uint16_t>(col_cnt_);
+    header.length_ = static_cast<uint32_t>(pos);
+    MEMCPY(agg_row_buf_, &header, sizeof(ObAggRowHeader));
+    buf = agg_row_buf_;
+    size = pos;
+  }
+  return ret;
+}
+
+ObAggRowReader::ObAggRowReader()
+  : is_inited_(false),
+    header_(),
+    buf_(nullptr),
+    buf_size_(0)
+{
+}
+
+void ObAggRowReader::reset()
+{
+  is_inited_ = false;
+  header_ = ObAggRowHeader();
+  buf_ = nullptr;
+  buf_size_ = 0;
+}
+
+int ObAggRowReader::init(const char *buf, const int64_t buf_size)
+{
+  int ret = OB_SUCCESS;
+  reset();
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_size < static_cast<int64_t>(sizeof(ObAggRowHeader)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument to init agg row reader", K(ret), KP(buf), K(buf_size));
+  } else if (FALSE_IT(MEMCPY(&header_, buf, sizeof(ObAggRowHeader)))) {
+  } else if (OB_UNLIKELY(!header_.is_valid() || header_.length_ > buf_size
+      || header_.length_ < sizeof(ObAggRowHeader) + header_.col_cnt_ * sizeof(ObAggColMeta))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid agg row header", K(ret), K_(header), K(buf_size));
+  } else {
+    buf_ = buf;
+    buf_size_ = header_.length_;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObAggRowReader::get_col_agg(const int64_t col_idx, ObSkipIndexColAgg &col_agg) const
+{
+  int ret = OB_SUCCESS;
+  col_agg.reset();
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Agg row reader not init", K(ret));
+  } else if (col_idx < 0 || col_idx >= header_.col_cnt_) {
+    // column not covered by skip index
+  } else {
+    ObAggColMeta col_meta;
+    int64_t pos = sizeof(ObAggRowHeader) + header_.col_cnt_ * sizeof(ObAggColMeta);
+    for (int64_t i = 0; i <= col_idx; ++i) {
+      MEMCPY(&col_meta, buf_ + sizeof(ObAggRowHeader) + i * sizeof(ObAggColMeta), sizeof(ObAggColMeta));
+      if (i < col_idx && col_meta.has_min_max()) {
+        pos += col_meta.min_len_ + col_meta.max_len_;
+      }
+    }
+    col_agg.is_covered_ = true;
+    col_agg.null_count_ = col_meta.null_count_;
+    if (!col_meta.has_min_max()) {
+    } else if (OB_UNLIKELY(pos + col_meta.min_len_ + col_meta.max_len_ > buf_size_)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Agg row payload out of range", K(ret), K(col_idx), K(col_meta), K(pos), K_(buf_size));
+    } else {
+      col_agg.has_min_max_ = true;
+      col_agg.min_.set_string(buf_ + pos, col_meta.min_len_);
+      col_agg.max_.set_string(buf_ + pos + col_meta.min_len_, col_meta.max_len_);
+    }
+  }
+  return ret;
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
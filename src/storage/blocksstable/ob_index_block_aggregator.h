@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
+
+#include "share/datum/ob_datum_funcs.h"
+#include "ob_datum_row.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+struct ObDataStoreDesc;
+
+/*
+ * Skip index aggregate row, appended after the index block row header of a
+ * pre-aggregated data micro block row:
+ *
+ * | ObAggRowHeader | ObAggColMeta * col_cnt | min/max payload of valid columns |
+ *
+ * Payload is stored in column order, min value followed by max value, without alignment.
+ */
+struct ObAggRowHeader
+{
+  static const uint8_t AGG_ROW_HEADER_VERSION = 1;
+  ObAggRowHeader() { MEMSET(this, 0, sizeof(ObAggRowHeader)); }
+  OB_INLINE bool is_valid() const
+  {
+    return AGG_ROW_HEADER_VERSION == version_ && length_ >= sizeof(ObAggRowHeader);
+  }
+  TO_STRING_KV(K_(version), K_(col_cnt), K_(length));
+
+  uint8_t version_;
+  uint8_t reserved_;
+  uint16_t col_cnt_;
+  uint32_t length_;
+} __attribute__((packed));
+
+struct ObAggColMeta
+{
+  static const uint16_t INVALID_LEN = UINT16_MAX;
+  ObAggColMeta() : null_count_(0), min_len_(INVALID_LEN), max_len_(INVALID_LEN) {}
+  OB_INLINE bool has_min_max() const { return INVALID_LEN != min_len_ && INVALID_LEN != max_len_; }
+  TO_STRING_KV(K_(null_count), K_(min_len), K_(max_len));
+
+  uint32_t null_count_;
+  uint16_t min_len_;
+  uint16_t max_len_;
+} __attribute__((packed));
+
+struct ObSkipIndexColAgg
+{
+  ObSkipIndexColAgg() { reset(); }
+  void reset()
+  {
+    is_covered_ = false;
+    has_min_max_ = false;
+    null_count_ = 0;
+    min_.set_null();
+    max_.set_null();
+  }
+  TO_STRING_KV(K_(is_covered), K_(has_min_max), K_(null_count), K_(min), K_(max));
+
+  bool is_covered_; // column has aggregate info in this agg row
+  bool has_min_max_;
+  int64_t null_count_;
+  ObDatum min_;
+  ObDatum max_;
+};
+
+// Collects per column min/max/null count of the rows appended to one data micro block
+class ObSkipIndexAggregator
+{
+public:
+  static const int64_t MAX_SKIP_INDEX_COL_CNT = 32;
+  static const int64_t MAX_SKIP_INDEX_VALUE_LEN = 16;
+  static const int64_t MAX_AGG_ROW_SIZE = sizeof(ObAggRowHeader)
+      + MAX_SKIP_INDEX_COL_CNT * (sizeof(ObAggColMeta) + 2 * MAX_SKIP_INDEX_VALUE_LEN);
+  ObSkipIndexAggregator();
+  ~ObSkipIndexAggregator() { reset(); }
+  int init(const ObDataStoreDesc &data_store_desc);
+  void reset();
+  void reuse();
+  int eval(const ObDatumRow &row);
+  // serialized agg row stays valid until next reuse()
+  int get_aggregated_row(const char *&buf, int64_t &size);
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  TO_STRING_KV(K_(is_inited), K_(col_cnt), K_(row_count));
+private:
+  struct ColAggregator
+  {
+    ColAggregator() { reset(); }
+    void reset();
+    void reuse();
+    int eval(const ObStorageDatum &datum);
+    void copy_datum(const ObDatum &src, char *buf, ObDatum &dst);
+    common::ObDatumCmpFuncType cmp_func_;
+    bool can_agg_min_max_; // column type supports min/max aggregation
+    bool is_valid_; // min/max is still valid for current micro block
+    bool has_value_;
+    int64_t null_count_;
+    ObDatum min_;
+    ObDatum max_;
+    char min_buf_[MAX_SKIP_INDEX_VALUE_LEN];
+    char max_buf_[MAX_SKIP_INDEX_VALUE_LEN];
+  };
+private:
+  bool is_inited_;
+  int64_t col_cnt_;
+  int64_t row_count_;
+  ColAggregator col_aggs_[MAX_SKIP_INDEX_COL_CNT];
+  char agg_row_buf_[MAX_AGG_ROW_SIZE];
+  DISALLOW_COPY_AND_ASSIGN(ObSkipIndexAggregator);
+};
+
+class ObAggRowReader
+{
+public:
+  ObAggRowReader();
+  ~ObAggRowReader() { reset(); }
+  int init(const char *buf, const int64_t buf_size);
+  void reset();
+  int get_col_agg(const int64_t col_idx, ObSkipIndexColAgg &col_agg) const;
+  TO_STRING_KV(K_(is_inited), K_(header), KP_(buf), K_(buf_size));
+private:
+  bool is_inited_;
+  ObAggRowHeader header_;
+  const char *buf_;
+  int64_t buf_size_;
+  DISALLOW_COPY_AND_ASSIGN(ObAggRowReader);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_BLOCK_AGGREGATOR_H_
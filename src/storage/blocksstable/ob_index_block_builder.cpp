@@ -1368,6 +1368,8 @@ void ObBaseIndexBlockBuilder::block_to_row_desc(
   row_desc.has_string_out_row_ = micro_block_desc.has_string_out_row_;
   row_desc.has_lob_out_row_ = micro_block_desc.has_lob_out_row_;
   row_desc.is_last_row_last_flag_ = micro_block_desc.is_last_row_last_flag_;
+  row_desc.agg_row_buf_ = micro_block_desc.agg_row_buf_;
+  row_desc.agg_buf_size_ = micro_block_desc.agg_buf_size_;
 }
 
 int ObBaseIndexBlockBuilder::meta_to_row_desc(
@@ -343,6 +343,10 @@ int ObIndexBlockRowScanner::get_next(ObMicroIndexInfo &idx_block_row)
     if (OB_FAIL(idx_row_parser_.get_minor_meta(idx_minor_info))) {
       LOG_WARN("Fail to get minor meta info", K(ret));
     }
+  } else if (idx_row_header->is_pre_aggregated() && IndexFormat::BLOCK_TREE != index_format_) {
+    if (OB_FAIL(idx_row_parser_.get_agg_row(idx_block_row.agg_row_buf_, idx_block_row.agg_buf_size_))) {
+      LOG_WARN("Fail to get aggregated row", K(ret));
+    }
   }
 
   if (OB_SUCC(ret)) {
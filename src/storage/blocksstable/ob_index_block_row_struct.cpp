@@ -14,6 +14,7 @@
 
 #include "common/row/ob_row.h"
 #include "ob_index_block_row_struct.h"
+#include "ob_index_block_aggregator.h"
 #include "ob_block_sstable_struct.h"
 
 namespace oceanbase
@@ -29,7 +30,7 @@ ObIndexBlockRowDesc::ObIndexBlockRowDesc()
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
     is_secondary_meta_(false), is_macro_node_(false), has_string_out_row_(false), has_lob_out_row_(false),
-    is_last_row_last_flag_(false) {}
+    is_last_row_last_flag_(false), agg_row_buf_(nullptr), agg_buf_size_(0) {}
 
 ObIndexBlockRowDesc::ObIndexBlockRowDesc(ObDataStoreDesc &data_store_desc)
   : data_store_desc_(&data_store_desc), row_key_(), macro_id_(), block_offset_(0),
@@ -37,7 +38,7 @@ ObIndexBlockRowDesc::ObIndexBlockRowDesc(ObDataStoreDesc &data_store_desc)
     macro_block_count_(0), micro_block_count_(0),
     is_deleted_(false), contain_uncommitted_row_(false), is_data_block_(false),
     is_secondary_meta_(false), is_macro_node_(false), has_string_out_row_(false), has_lob_out_row_(false),
-    is_last_row_last_flag_(false) {}
+    is_last_row_last_flag_(false), agg_row_buf_(nullptr), agg_buf_size_(0) {}
 
 MacroBlockId ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID(0, DEFAULT_IDX_ROW_MACRO_IDX, 0);
 
@@ -248,10 +249,9 @@ int ObIndexBlockRowBuilder::calc_data_size(const ObIndexBlockRowDesc &desc, int6
     size = sizeof(ObIndexBlockRowHeader);
   } else if (desc.data_store_desc_->is_major_merge()) {
     size = sizeof(ObIndexBlockRowHeader);
-    // if (desc.is_pre_aggregated_) {
-      // TODO: @saitong.zst Calculate aggregate size here
-      // size += aggregate_size;
-    // }
+    if (desc.is_data_block_ && nullptr != desc.agg_row_buf_ && desc.agg_buf_size_ > 0) {
+      size += desc.agg_buf_size_;
+    }
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
@@ -271,6 +271,16 @@ int ObIndexBlockRowBuilder::calc_data_size(
     size = sizeof(ObIndexBlockRowHeader);
   } else if (idx_row_header.is_major_node()) {
     size = sizeof(ObIndexBlockRowHeader);
+    if (idx_row_header.is_pre_aggregated()) {
+      ObAggRowHeader agg_row_header;
+      MEMCPY(&agg_row_header, reinterpret_cast<const char *>(&idx_row_header) + size, sizeof(ObAggRowHeader));
+      if (OB_UNLIKELY(!agg_row_header.is_valid())) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Invalid aggregated row header", K(ret), K(agg_row_header), K(idx_row_header));
+      } else {
+        size += agg_row_header.length_;
+      }
+    }
   } else {
     size = sizeof(ObIndexBlockRowHeader) + sizeof(ObIndexBlockRowMinorMetaInfo);
   }
@@ -296,7 +306,8 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
     header_->is_major_node_ = desc.data_store_desc_->is_major_merge();
     header_->has_string_out_row_ = desc.has_string_out_row_;
     header_->all_lob_in_row_ = !desc.has_lob_out_row_;
-    // header_->is_pre_aggregated_ =
+    header_->is_pre_aggregated_ = desc.data_store_desc_->is_major_merge() && desc.is_data_block_
+        && nullptr != desc.agg_row_buf_ && desc.agg_buf_size_ > 0;
     header_->is_deleted_ = desc.is_deleted_;
     header_->macro_id_ =(desc.is_data_block_ && is_data_mid_micro_block)
         ? ObIndexBlockRowHeader::DEFAULT_IDX_ROW_MACRO_ID : desc.macro_id_;
@@ -330,20 +341,23 @@ int ObIndexBlockRowBuilder::append_header_and_meta(const ObIndexBlockRowDesc &de
 int ObIndexBlockRowBuilder::append_aggregate_data(const ObIndexBlockRowDesc &desc)
 {
   int ret = OB_SUCCESS;
-  UNUSED(desc);
   if (OB_ISNULL(header_)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Fail to append aggregation data to buffer", K(ret), KP_(header));
   } else if (!header_->is_pre_aggregated()) {
+  } else if (OB_ISNULL(desc.agg_row_buf_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null aggregated row for pre-aggregated index row", K(ret), K(desc));
   } else {
-    // TODO: @saitong.zst Write aggregate data here
+    MEMCPY(data_buf_ + write_pos_, desc.agg_row_buf_, desc.agg_buf_size_);
+    write_pos_ += desc.agg_buf_size_;
   }
   return ret;
 }
 
 
 ObIndexBlockRowParser::ObIndexBlockRowParser()
-  : header_(nullptr), minor_meta_info_(nullptr), is_inited_(false) {}
+  : header_(nullptr), minor_meta_info_(nullptr), agg_row_buf_(nullptr), agg_buf_size_(0), is_inited_(false) {}
 
 int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatumRow &row)
 {
@@ -369,6 +383,8 @@ int ObIndexBlockRowParser::init(const int64_t rowkey_column_count, const ObDatum
 int ObIndexBlockRowParser::init(const char *data_buf)
 {
   int ret = OB_SUCCESS;
+  agg_row_buf_ = nullptr;
+  agg_buf_size_ = 0;
   if (OB_ISNULL(data_buf)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("Unexpected null data buffer for index block row data", K(ret));
@@ -383,10 +399,19 @@ int ObIndexBlockRowParser::init(const char *data_buf)
     const int64_t minor_meta_offset = sizeof(ObIndexBlockRowHeader);
     minor_meta_info_ = reinterpret_cast<const ObIndexBlockRowMinorMetaInfo *>(
       data_buf + minor_meta_offset);
+  } else if (header_->is_pre_aggregated()) {
+    ObAggRowHeader agg_row_header;
+    const int64_t agg_row_offset = sizeof(ObIndexBlockRowHeader);
+    MEMCPY(&agg_row_header, data_buf + agg_row_offset, sizeof(ObAggRowHeader));
+    if (OB_UNLIKELY(!agg_row_header.is_valid())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_ERROR("Invalid aggregated row header parsed from data", K(ret), K(agg_row_header), KPC(header_));
+    } else {
+      agg_row_buf_ = data_buf + agg_row_offset;
+      agg_buf_size_ = agg_row_header.length_;
+    }
   }
 
-  // TODO: @saitong.zst locate aggregated data logic here
-
   if (OB_SUCC(ret)) {
     is_inited_ = true;
   }
@@ -420,6 +445,19 @@ int ObIndexBlockRowParser::get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&m
   return ret;
 }
 
+int ObIndexBlockRowParser::get_agg_row(const char *&agg_row_buf, int64_t &agg_buf_size) const
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not inited", K(ret));
+  } else {
+    agg_row_buf = agg_row_buf_;
+    agg_buf_size = agg_buf_size_;
+  }
+  return ret;
+}
+
 int ObIndexBlockRowParser::is_macro_node(bool &is_macro_node) const
 {
   int ret = OB_SUCCESS;
@@ -49,7 +49,6 @@ struct ObIndexBlockRowDesc
     return ret;
   }
 
-  // const ObSSTablePreAggreator *aggregator_;
   const ObDataStoreDesc *data_store_desc_;
   ObDatumRowkey row_key_;
   MacroBlockId macro_id_;
@@ -68,6 +67,8 @@ struct ObIndexBlockRowDesc
   bool has_string_out_row_;
   bool has_lob_out_row_;
   bool is_last_row_last_flag_;
+  const char *agg_row_buf_; // skip index aggregated row of data micro block
+  int64_t agg_buf_size_;
 
   TO_STRING_KV(KP_(data_store_desc), K_(row_key), K_(macro_id),
       K_(block_offset), K_(row_count), K_(row_count_delta),
@@ -75,7 +76,7 @@ struct ObIndexBlockRowDesc
       K_(macro_block_count), K_(micro_block_count),
       K_(is_deleted), K_(contain_uncommitted_row), K_(is_data_block),
       K_(is_secondary_meta), K_(is_macro_node), K_(has_string_out_row), K_(has_lob_out_row),
-      K_(is_last_row_last_flag));
+      K_(is_last_row_last_flag), KP_(agg_row_buf), K_(agg_buf_size));
 };
 
 struct ObIndexBlockRowHeader
@@ -201,6 +202,8 @@ public:
     : row_header_(nullptr),
       minor_meta_info_(nullptr),
       endkey_(nullptr),
+      agg_row_buf_(nullptr),
+      agg_buf_size_(0),
       query_range_(nullptr),
       flag_(0),
       range_idx_(-1),
@@ -213,6 +216,8 @@ public:
     row_header_ = nullptr;
     minor_meta_info_ = nullptr;
     endkey_ = nullptr;
+    agg_row_buf_ = nullptr;
+    agg_buf_size_ = 0;
     query_range_ = nullptr;
     flag_ = 0;
     range_idx_ = -1;
@@ -305,6 +310,10 @@ public:
     OB_ASSERT(nullptr != row_header_);
     return row_header_->has_lob_out_row();
   }
+  OB_INLINE bool has_agg_row() const
+  {
+    return nullptr != agg_row_buf_ && agg_buf_size_ > 0;
+  }
   OB_INLINE bool is_left_border() const
   {
     return is_left_border_;
@@ -358,13 +367,14 @@ public:
   }
 
   TO_STRING_KV(KP_(query_range), KPC_(row_header), KPC_(minor_meta_info), KPC_(endkey),
-      K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
+      KP_(agg_row_buf), K_(agg_buf_size), K_(flag), K_(range_idx), K_(parent_macro_id), K_(nested_offset));
 
 public:
   const ObIndexBlockRowHeader *row_header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
   const ObDatumRowkey *endkey_;
-  // ObPreAggDataStore *pre_agg_data_;
+  const char *agg_row_buf_;
+  int64_t agg_buf_size_;
   union {
     const ObDatumRowkey *rowkey_;
     const ObDatumRange *range_;
@@ -433,6 +443,7 @@ public:
   int init(const char *data_buf);
   int get_header(const ObIndexBlockRowHeader *&header) const;
   int get_minor_meta(const ObIndexBlockRowMinorMetaInfo *&meta) const;
+  int get_agg_row(const char *&agg_row_buf, int64_t &agg_buf_size) const;
   int is_macro_node(bool &is_macro_node) const;
   int64_t get_snapshot_version() const;
   int64_t get_max_merged_trans_version() const;
@@ -442,7 +453,8 @@ public:
 private:
   const ObIndexBlockRowHeader *header_;
   const ObIndexBlockRowMinorMetaInfo *minor_meta_info_;
-  // Aggregate data read struct
+  const char *agg_row_buf_;
+  int64_t agg_buf_size_;
   bool is_inited_;
 };
 
@@ -17,6 +17,7 @@
 #include "ob_macro_block.h"
 #include "ob_micro_block_hash_index.h"
 #include "observer/ob_server_struct.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 #include "share/ob_encryption_util.h"
 #include "share/ob_force_print_log.h"
 #include "share/ob_task_define.h"
@@ -173,6 +174,11 @@ int ObDataStoreDesc::init(
         STORAGE_LOG(WARN, "Failed to reserve column desc array", K(ret));
       } else if (OB_FAIL(merge_schema.get_multi_version_column_descs(col_desc_array_))) {
         STORAGE_LOG(WARN, "Failed to generate multi version column ids", K(ret));
+      } else if (is_major_merge()) {
+        omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+        if (tenant_config.is_valid()) {
+          enable_skip_index_ = tenant_config->_enable_skip_index;
+        }
       }
     } else {
       if (OB_FAIL(col_desc_array_.init(rowkey_column_count_))) {
@@ -445,6 +451,7 @@ void ObDataStoreDesc::reset()
   need_pre_warm_ = false;
   is_force_flat_store_type_ = false;
   default_col_checksum_array_valid_ = false;
+  enable_skip_index_ = false;
   col_desc_array_.reset();
   col_default_checksum_array_.reset();
   datum_utils_.reset();
@@ -482,6 +489,7 @@ int ObDataStoreDesc::assign(const ObDataStoreDesc &desc)
   is_ddl_ = desc.is_ddl_;
   need_pre_warm_ = desc.need_pre_warm_;
   is_force_flat_store_type_ = desc.is_force_flat_store_type_;
+  enable_skip_index_ = desc.enable_skip_index_;
   col_desc_array_.reset();
   col_default_checksum_array_.reset();
   datum_utils_.reset();
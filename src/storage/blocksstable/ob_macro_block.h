@@ -82,6 +82,7 @@ struct ObDataStoreDesc
   bool need_pre_warm_;
   bool is_force_flat_store_type_;
   bool default_col_checksum_array_valid_;
+  bool enable_skip_index_; // build min/max/null count aggregate for each micro block in major sstable
   common::ObArenaAllocator allocator_;
   common::ObFixedArray<int64_t, common::ObIAllocator> col_default_checksum_array_;
   blocksstable::ObStorageDatumUtils datum_utils_;
@@ -165,6 +166,7 @@ struct ObDataStoreDesc
       K_(major_working_cluster_version),
       KP_(sstable_index_builder),
       K_(is_ddl),
+      K_(enable_skip_index),
       K_(col_desc_array),
       K_(col_default_checksum_array));
 
@@ -365,7 +365,8 @@ ObMacroBlockWriter::ObMacroBlockWriter()
    check_datum_row_(),
    callback_(nullptr),
    builder_(NULL),
-   data_block_pre_warmer_()
+   data_block_pre_warmer_(),
+   skip_index_aggregator_()
 {
   //macro_blocks_, macro_handles_
 }
@@ -410,6 +411,7 @@ void ObMacroBlockWriter::reset()
   allocator_.reset();
   rowkey_allocator_.reset();
   data_block_pre_warmer_.reset();
+  skip_index_aggregator_.reset();
 }
 
 
@@ -467,6 +469,10 @@ int ObMacroBlockWriter::open(
        MEMSET(curr_micro_column_checksum_, 0,
            sizeof(int64_t) * data_store_desc_->row_column_count_);
       }
+      if (OB_FAIL(ret) || !data_store_desc_->enable_skip_index_) {
+      } else if (OB_FAIL(skip_index_aggregator_.init(data_store_desc))) {
+        STORAGE_LOG(WARN, "Failed to init skip index aggregator", K(ret));
+      }
     }
     if (OB_FAIL(ret)) {
     } else if (OB_NOT_NULL(sstable_index_builder)) {
@@ -851,6 +857,8 @@ int ObMacroBlockWriter::append_row_and_hash_index(const ObDatumRow &row)
     if (ret != OB_BUF_NOT_ENOUGH) {
       STORAGE_LOG(WARN, "Failed to append row in micro writer", K(ret), K(row));
     }
+  } else if (skip_index_aggregator_.is_inited() && OB_FAIL(skip_index_aggregator_.eval(row))) {
+    STORAGE_LOG(WARN, "Failed to eval row for skip index", K(ret), K(row));
   } else if (hash_index_builder_.is_valid()) {
     if (OB_UNLIKELY(FLAT_ROW_STORE != data_store_desc_->row_store_type_)) {
       ret = OB_ERR_UNEXPECTED;
@@ -905,6 +913,9 @@ int ObMacroBlockWriter::build_micro_block()
     STORAGE_LOG(WARN, "failed to build micro block desc", K(ret));
   } else if (OB_FAIL(build_hash_index_block(micro_block_desc))) {
     STORAGE_LOG(WARN, "Failed to build hash index block", K(ret));
+  } else if (skip_index_aggregator_.is_inited() && OB_FAIL(skip_index_aggregator_.get_aggregated_row(
+      micro_block_desc.agg_row_buf_, micro_block_desc.agg_buf_size_))) {
+    STORAGE_LOG(WARN, "Failed to get skip index aggregated row", K(ret));
   } else {
     micro_block_desc.last_rowkey_ = last_key_;
     block_size = micro_block_desc.buf_size_;
@@ -941,6 +952,9 @@ int ObMacroBlockWriter::build_micro_block()
 
   if (OB_SUCC(ret)) {
     micro_writer_->reuse();
+    if (skip_index_aggregator_.is_inited()) {
+      skip_index_aggregator_.reuse();
+    }
     if (data_store_desc_->need_build_hash_index_for_micro_block_) {
       hash_index_builder_.reuse();
     }
@@ -1028,6 +1042,10 @@ int ObMacroBlockWriter::build_micro_block_desc_with_reuse(
     micro_block_desc.has_string_out_row_ = micro_block.micro_index_info_->has_string_out_row();
     micro_block_desc.has_lob_out_row_ = micro_block.micro_index_info_->has_lob_out_row();
     micro_block_desc.original_size_ = header.original_length_;
+    if (skip_index_aggregator_.is_inited()) {
+      micro_block_desc.agg_row_buf_ = micro_block.micro_index_info_->agg_row_buf_;
+      micro_block_desc.agg_buf_size_ = micro_block.micro_index_info_->agg_buf_size_;
+    }
   }
   STORAGE_LOG(DEBUG, "build micro block desc reuse", K(data_store_desc_->tablet_id_), K(micro_block_desc), "lbt", lbt(), K(ret));
   return ret;
@@ -18,6 +18,7 @@
 #include "lib/compress/ob_compressor.h"
 #include "lib/container/ob_array_wrap.h"
 #include "ob_block_manager.h"
+#include "ob_index_block_aggregator.h"
 #include "ob_index_block_row_struct.h"
 #include "ob_macro_block_checker.h"
 #include "ob_macro_block_reader.h"
@@ -227,6 +228,7 @@ private:
   ObDataIndexBlockBuilder *builder_;
   ObMicroBlockAdaptiveSplitter micro_block_adaptive_splitter_;
   ObDataBlockCachePreWarmer data_block_pre_warmer_;
+  ObSkipIndexAggregator skip_index_aggregator_;
 };
 
 }//end namespace blocksstable
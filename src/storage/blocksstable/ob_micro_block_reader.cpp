@@ -842,5 +842,51 @@ int ObMicroBlockReader::get_aggregate_result(
   return ret;
 }
 
+int ObMicroBlockReader::get_aggregate_result(
+    const int32_t col,
+    const share::schema::ObColumnParam *col_param,
+    const int64_t *row_ids,
+    const int64_t row_cap,
+    storage::ObAggCell &agg_cell)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr == header_ ||
+                  nullptr == read_info_ ||
+                  row_cap > header_->row_count_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", K(ret), KPC(header_), KPC_(read_info), K(row_cap), K(col));
+  } else {
+    int64_t row_idx = common::OB_INVALID_INDEX;
+    const ObColumnIndexArray &cols_index = read_info_->get_columns_index();
+    int64_t col_idx = cols_index.at(col);
+    ObStorageDatum datum;
+    for (int64_t i = 0; OB_SUCC(ret) && i < row_cap; ++i) {
+      row_idx = row_ids[i];
+      if (OB_UNLIKELY(row_idx < 0 || row_idx >= header_->row_count_)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("Uexpected row idx", K(ret), K(row_idx), KPC(header_));
+      } else if (OB_FAIL(flat_row_reader_.read_column(
+          data_begin_ + index_data_[row_idx],
+          index_data_[row_idx + 1] - index_data_[row_idx],
+          col_idx,
+          datum))) {
+        LOG_WARN("fail to read column", K(ret), K(i), K(col_idx), K(row_idx));
+      } else if (datum.is_nop()) {
+        if (OB_UNLIKELY(nullptr == col_param || col_param->get_orig_default_value().is_nop_value())) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected datum, can not process in batch", K(ret), K(col), KPC(col_param));
+        } else if (OB_FAIL(datum.from_obj_enhance(col_param->get_orig_default_value()))) {
+          STORAGE_LOG(WARN, "Failed to transfer obj to datum", K(ret));
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(agg_cell.eval(datum))) {
+        LOG_WARN("Failed to eval agg cell", K(ret), K(i), K(row_idx), K(datum), K(agg_cell));
+      }
+    }
+  }
+  return ret;
+}
+
 }
 }
@@ -123,6 +123,12 @@ public:
       const int64_t row_cap,
       ObDatumRow &row_buf,
       common::ObIArray<storage::ObAggCell*> &agg_cells);
+  int get_aggregate_result(
+      const int32_t col,
+      const share::schema::ObColumnParam *col_param,
+      const int64_t *row_ids,
+      const int64_t row_cap,
+      storage::ObAggCell &agg_cell);
   OB_INLINE bool single_version_rows() { return nullptr != header_ && header_->single_version_rows_; }
 
 protected:
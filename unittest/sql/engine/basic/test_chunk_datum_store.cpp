@@ -25,6 +25,7 @@
 #include "share/datum/ob_datum.h"
 #include "sql/engine/expr/ob_expr.h"
 #include "share/ob_simple_mem_limit_getter.h"
+#include "lib/compress/ob_compressor_pool.h"
 
 namespace oceanbase
 {
@@ -941,6 +942,39 @@ TEST_F(TestChunkDatumStore, test_only_disk_data1)
   rs.reset();
 }
 
+TEST_F(TestChunkDatumStore, test_compressed_dump)
+{
+  int64_t cnt = 10000;
+  ObChunkDatumStore rs;
+  ASSERT_EQ(OB_SUCCESS, rs.alloc_dir_id());
+  ObChunkDatumStore::Iterator it;
+  ASSERT_EQ(OB_SUCCESS, rs.init(0, tenant_id_, ctx_id_, label_));
+  rs.set_mem_limit(1L << 30);
+  // compressor is decided by tenant config when file opened, uncompressed by default
+  CALL(append_rows, rs, cnt);
+  ASSERT_EQ(OB_SUCCESS, rs.dump(false, true));
+  const int64_t raw_size = rs.get_file_size();
+  ASSERT_TRUE(NULL == rs.get_compressor());
+  // following blocks are compressed
+  ObCompressor *compressor = NULL;
+  ASSERT_EQ(OB_SUCCESS, ObCompressorPool::get_instance().get_compressor(LZ4_COMPRESSOR,
+                                                                        compressor));
+  rs.set_compressor(compressor);
+  CALL(append_rows, rs, cnt);
+  ASSERT_EQ(OB_SUCCESS, rs.dump(false, true));
+  // memory data
+  CALL(append_rows, rs, cnt);
+  rs.finish_add_row(false);
+  ASSERT_LT(rs.get_file_size() - raw_size, raw_size);
+  LOG_INFO("compressed file size", K(raw_size), K(rs.get_file_size()));
+
+  CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true, ObChunkDatumStore::BLOCK_SIZE);
+  it.reset();
+  CALL(verify_n_rows, rs, it, rs.get_row_cnt(), true, 0);
+  it.reset();
+  rs.reset();
+}
+
 TEST_F(TestChunkDatumStore, test_append_block)
 {
   int ret = OB_SUCCESS;
@@ -1003,6 +1037,48 @@ TEST_F(TestChunkDatumStore, test_append_block)
   rs2.reset();
 }
 
+TEST_F(TestChunkDatumStore, test_block_buffer_append_batch)
+{
+  BatchGuard g(*this);
+  const int64_t buf_size = 16L << 10;
+  char *buf = static_cast<char *>(alloc_.alloc(buf_size));
+  ASSERT_TRUE(NULL != buf);
+  for (int64_t i = 0; i < batch_size_; i++) {
+    gen_row(i, i);
+  }
+  // append odd rows in reverse order, buffer is full before all rows appended
+  uint16_t *selector = static_cast<uint16_t *>(alloc_.alloc(sizeof(uint16_t) * batch_size_));
+  ASSERT_TRUE(NULL != selector);
+  int64_t size = 0;
+  for (int64_t i = batch_size_ - 1; i >= 0; i--) {
+    if (i % 2 == 1) {
+      selector[size++] = static_cast<uint16_t>(i);
+    }
+  }
+  ObChunkDatumStore::BlockBufferWrap blk_buf;
+  ASSERT_EQ(OB_SUCCESS, blk_buf.init(buf, buf_size));
+  int64_t appended = 0;
+  ASSERT_EQ(OB_SUCCESS, blk_buf.append_batch(cells_, eval_ctx_, selector, size, appended));
+  ASSERT_GT(appended, 0);
+  ASSERT_LT(appended, size);
+  ASSERT_EQ(appended, blk_buf.rows_);
+
+  int64_t pos = 0;
+  for (int64_t i = 0; i < appended; i++) {
+    ObChunkDatumStore::StoredRow *sr =
+        reinterpret_cast<ObChunkDatumStore::StoredRow *>(buf + pos);
+    sr->swizzling();
+    const ObDatum *src_str = &cells_.at(2)->locate_batch_datums(eval_ctx_)[selector[i]];
+    ASSERT_EQ(3, sr->cnt_);
+    ASSERT_EQ(selector[i], sr->cells()[0].get_int());
+    ASSERT_TRUE(sr->cells()[1].is_null());
+    ASSERT_EQ(src_str->len_, sr->cells()[2].len_);
+    ASSERT_EQ(0, MEMCMP(src_str->ptr_, sr->cells()[2].ptr_, src_str->len_));
+    pos += sr->row_size_;
+  }
+  ASSERT_EQ(pos, blk_buf.data_size());
+}
+
 } // end namespace sql
 } // end namespace oceanbase
 
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/basic/ob_group_join_buffer.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+class TestGroupJoinBuffer : public ::testing::Test
+{
+protected:
+  // left child filled the buffer with %row_cnt rows, then the right side is rescanned
+  void fill_group(ObGroupJoinBufffer &buffer, const int64_t row_cnt, const bool is_left_end)
+  {
+    buffer.left_store_.row_cnt_ = row_cnt;
+    buffer.is_left_end_ = is_left_end;
+    buffer.grow_group_scan_size();
+  }
+};
+
+TEST_F(TestGroupJoinBuffer, grow_group_size)
+{
+  ObGroupJoinBufffer buffer;
+  buffer.enable_adaptive_group_size_ = true;
+  buffer.group_scan_size_ = 1000;
+  buffer.reset_group_scan_size();
+  ASSERT_EQ(ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, buffer.cur_group_scan_size_);
+  ASSERT_FALSE(buffer.is_full());
+  int64_t expect_sizes[] = { 128, 256, 512, 1000, 1000 };
+  for (int64_t i = 0; i < ARRAYSIZEOF(expect_sizes); ++i) {
+    fill_group(buffer, buffer.cur_group_scan_size_, false);
+    ASSERT_EQ(expect_sizes[i], buffer.cur_group_scan_size_);
+  }
+  // rescan of left child starts with a small group again
+  buffer.reset_group_scan_size();
+  ASSERT_EQ(ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, buffer.cur_group_scan_size_);
+  buffer.left_store_.row_cnt_ = 0;
+}
+
+TEST_F(TestGroupJoinBuffer, keep_group_size)
+{
+  ObGroupJoinBufffer buffer;
+  buffer.enable_adaptive_group_size_ = true;
+  buffer.group_scan_size_ = 1000;
+  buffer.reset_group_scan_size();
+  // left child ends within the group
+  fill_group(buffer, 10, true);
+  ASSERT_EQ(ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, buffer.cur_group_scan_size_);
+  // left child ends exactly at a full group
+  fill_group(buffer, ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, true);
+  ASSERT_EQ(ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, buffer.cur_group_scan_size_);
+  // group not full, e.g. the batch of left child stops early
+  fill_group(buffer, ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE - 1, false);
+  ASSERT_EQ(ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, buffer.cur_group_scan_size_);
+  buffer.left_store_.row_cnt_ = 0;
+}
+
+TEST_F(TestGroupJoinBuffer, small_plan_group_size)
+{
+  ObGroupJoinBufffer buffer;
+  // group size chosen by plan is never exceeded
+  buffer.group_scan_size_ = 10;
+  buffer.reset_group_scan_size();
+  ASSERT_EQ(10, buffer.cur_group_scan_size_);
+  fill_group(buffer, 10, false);
+  ASSERT_TRUE(buffer.is_full());
+  ASSERT_EQ(10, buffer.cur_group_scan_size_);
+  buffer.group_scan_size_ = 100;
+  buffer.reset_group_scan_size();
+  fill_group(buffer, ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, false);
+  ASSERT_EQ(100, buffer.cur_group_scan_size_);
+  buffer.left_store_.row_cnt_ = 0;
+}
+
+TEST_F(TestGroupJoinBuffer, adaptive_disabled)
+{
+  ObGroupJoinBufffer buffer;
+  // full group from the first fill by default
+  buffer.group_scan_size_ = 1000;
+  buffer.reset_group_scan_size();
+  ASSERT_EQ(1000, buffer.cur_group_scan_size_);
+  fill_group(buffer, 1000, false);
+  ASSERT_EQ(1000, buffer.cur_group_scan_size_);
+  // multi level group rescan always fills groups by the above group size
+  buffer.enable_adaptive_group_size_ = true;
+  buffer.is_multi_level_ = true;
+  buffer.reset_group_scan_size();
+  ASSERT_EQ(1000, buffer.cur_group_scan_size_);
+  buffer.is_multi_level_ = false;
+  buffer.reset_group_scan_size();
+  ASSERT_EQ(ObGroupJoinBufffer::MIN_GROUP_SCAN_SIZE, buffer.cur_group_scan_size_);
+  buffer.left_store_.row_cnt_ = 0;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_group_join_buffer.log*");
+  OB_LOGGER.set_file_name("test_group_join_buffer.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,174 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/recursive_cte/ob_search_method_op.h"
+#include "sql/engine/expr/ob_expr.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+class TestBreadthFirstSearch : public ::testing::Test
+{
+public:
+  static const int64_t COL_CNT = 2;
+  TestBreadthFirstSearch() : allocator_(ObModIds::TEST), left_output_(allocator_) {}
+  virtual void SetUp()
+  {
+    ObExprBasicFuncs *funcs = ObDatumFuncs::get_basic_func(ObIntType, CS_TYPE_BINARY);
+    ASSERT_TRUE(NULL != funcs);
+    ASSERT_EQ(OB_SUCCESS, left_output_.init(COL_CNT));
+    for (int64_t i = 0; i < COL_CNT; ++i) {
+      exprs_[i].basic_funcs_ = funcs;
+      ASSERT_EQ(OB_SUCCESS, left_output_.push_back(&exprs_[i]));
+    }
+  }
+protected:
+  ObChunkDatumStore::StoredRow *make_row(const int64_t c0, const int64_t c1);
+  // add %row as the only child of current parent node, and move down to it
+  void add_level(ObBreadthFisrtSearchOp &search, ObChunkDatumStore::StoredRow *row,
+                 ObSearchMethodOp::ObTreeNode &node, const int expect_ret = OB_SUCCESS);
+protected:
+  ObArenaAllocator allocator_;
+  ObExpr exprs_[COL_CNT];
+  ExprFixedArray left_output_;
+  ObArray<ObSortFieldCollation> sort_collations_;
+};
+
+ObChunkDatumStore::StoredRow *TestBreadthFirstSearch::make_row(const int64_t c0, const int64_t c1)
+{
+  const int64_t size = sizeof(ObChunkDatumStore::StoredRow)
+      + COL_CNT * (sizeof(ObDatum) + sizeof(int64_t));
+  char *buf = static_cast<char *>(allocator_.alloc(size));
+  ObChunkDatumStore::StoredRow *row = NULL;
+  if (NULL != buf) {
+    row = reinterpret_cast<ObChunkDatumStore::StoredRow *>(buf);
+    row->cnt_ = COL_CNT;
+    row->row_size_ = static_cast<uint32_t>(size);
+    ObDatum *cells = row->cells();
+    int64_t *data = reinterpret_cast<int64_t *>(cells + COL_CNT);
+    const int64_t values[COL_CNT] = { c0, c1 };
+    for (int64_t i = 0; i < COL_CNT; ++i) {
+      cells[i].ptr_ = reinterpret_cast<const char *>(data + i);
+      cells[i].set_int(values[i]);
+    }
+  }
+  return row;
+}
+
+void TestBreadthFirstSearch::add_level(ObBreadthFisrtSearchOp &search,
+                                       ObChunkDatumStore::StoredRow *row,
+                                       ObSearchMethodOp::ObTreeNode &node,
+                                       const int expect_ret)
+{
+  ASSERT_TRUE(NULL != row);
+  ASSERT_EQ(OB_SUCCESS, search.input_rows_.push_back(row));
+  ASSERT_EQ(expect_ret, search.add_result_rows());
+  if (OB_SUCCESS == expect_ret) {
+    ASSERT_EQ(1, search.search_results_.count());
+    node = search.search_results_.at(0);
+    search.search_results_.reuse();
+    if (!node.is_cycle_) {
+      ASSERT_EQ(OB_SUCCESS, search.update_parent_node(node));
+    }
+  }
+}
+
+TEST_F(TestBreadthFirstSearch, cycle_by_columns)
+{
+  ObArray<uint64_t> cycle_by_columns;
+  ASSERT_EQ(OB_SUCCESS, cycle_by_columns.push_back(0));
+  ObBreadthFisrtSearchOp search(allocator_, left_output_, sort_collations_, cycle_by_columns);
+  ObSearchMethodOp::ObTreeNode node_a;
+  ObSearchMethodOp::ObTreeNode node_b;
+  ObSearchMethodOp::ObTreeNode node;
+  add_level(search, make_row(1, 10), node_a);
+  ASSERT_FALSE(node_a.is_cycle_);
+  add_level(search, make_row(2, 20), node_b);
+  ASSERT_FALSE(node_b.is_cycle_);
+  uint64_t hash_val = 0;
+  ASSERT_EQ(OB_SUCCESS, search.calc_cycle_hash(*node_a.stored_row_, hash_val));
+  ASSERT_EQ(hash_val, node_a.in_bstree_node_->hash_val_);
+
+  // same cycle column as the root ancestor, other columns are not compared
+  add_level(search, make_row(1, 30), node);
+  ASSERT_TRUE(node.is_cycle_);
+  ASSERT_EQ(node_a.in_bstree_node_->hash_val_, node.in_bstree_node_->hash_val_);
+  // the cycle node is a leaf, search goes on below node_b
+  search.current_parent_node_->child_num_ = 0;
+
+  // hash values of all ancestors collide with the new row, rows differ
+  const uint64_t hash_a = node_a.in_bstree_node_->hash_val_;
+  const uint64_t hash_b = node_b.in_bstree_node_->hash_val_;
+  ObChunkDatumStore::StoredRow *row = make_row(3, 10);
+  ASSERT_TRUE(NULL != row);
+  ASSERT_EQ(OB_SUCCESS, search.calc_cycle_hash(*row, hash_val));
+  node_a.in_bstree_node_->hash_val_ = hash_val;
+  node_b.in_bstree_node_->hash_val_ = hash_val;
+  add_level(search, row, node);
+  ASSERT_FALSE(node.is_cycle_);
+  ASSERT_EQ(hash_val, node.in_bstree_node_->hash_val_);
+  node_a.in_bstree_node_->hash_val_ = hash_a;
+  node_b.in_bstree_node_->hash_val_ = hash_b;
+
+  // ancestors above the collided node are still checked
+  add_level(search, make_row(2, 40), node);
+  ASSERT_TRUE(node.is_cycle_);
+}
+
+TEST_F(TestBreadthFirstSearch, whole_row)
+{
+  ObArray<uint64_t> cycle_by_columns;
+  ObBreadthFisrtSearchOp search(allocator_, left_output_, sort_collations_, cycle_by_columns);
+  ObSearchMethodOp::ObTreeNode node_a;
+  ObSearchMethodOp::ObTreeNode node;
+  add_level(search, make_row(1, 10), node_a);
+  add_level(search, make_row(1, 20), node);
+  ASSERT_FALSE(node.is_cycle_);
+
+  // collided hash values with different rows are not a cycle
+  ObSearchMethodOp::ObTreeNode node_b = node;
+  const uint64_t hash_a = node_a.in_bstree_node_->hash_val_;
+  const uint64_t hash_b = node_b.in_bstree_node_->hash_val_;
+  ObChunkDatumStore::StoredRow *row = make_row(2, 10);
+  ASSERT_TRUE(NULL != row);
+  uint64_t hash_val = 0;
+  ASSERT_EQ(OB_SUCCESS, search.calc_cycle_hash(*row, hash_val));
+  node_a.in_bstree_node_->hash_val_ = hash_val;
+  node_b.in_bstree_node_->hash_val_ = hash_val;
+  add_level(search, row, node);
+  ASSERT_FALSE(node.is_cycle_);
+  node_a.in_bstree_node_->hash_val_ = hash_a;
+  node_b.in_bstree_node_->hash_val_ = hash_b;
+
+  // same whole row as an ancestor
+  add_level(search, make_row(1, 20), node, OB_ERR_CYCLE_FOUND_IN_RECURSIVE_CTE);
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_search_method_op.log*");
+  OB_LOGGER.set_file_name("test_search_method_op.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,234 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/engine/window_function/ob_window_function_op.h"
+#include "share/datum/ob_datum_funcs.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+typedef ObWindowFunctionOp::ExtremumQueue ExtremumQueue;
+typedef ObWindowFunctionOp::Frame Frame;
+
+class TestExtremumQueue : public ::testing::Test
+{
+public:
+  static const int64_t ROW_CNT = 1000;
+  TestExtremumQueue() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp()
+  {
+    int_cmp_ = ObDatumFuncs::get_basic_func(ObIntType, CS_TYPE_BINARY)->null_first_cmp_;
+    str_cmp_ = ObDatumFuncs::get_basic_func(ObVarcharType, CS_TYPE_UTF8MB4_BIN)->null_first_cmp_;
+    ASSERT_TRUE(NULL != int_cmp_);
+    ASSERT_TRUE(NULL != str_cmp_);
+  }
+protected:
+  // slide the queue over @datums, rows are read the same way as the operator reads input rows
+  void slide(ExtremumQueue &queue, const ObDatum *datums, const Frame &frame,
+             bool &is_null, ObDatum &val);
+  void check_int_frames(const bool is_max, const int64_t preceding, const int64_t following);
+protected:
+  ObArenaAllocator allocator_;
+  ObExprCmpFuncType int_cmp_;
+  ObExprCmpFuncType str_cmp_;
+};
+
+void TestExtremumQueue::slide(ExtremumQueue &queue, const ObDatum *datums, const Frame &frame,
+                              bool &is_null, ObDatum &val)
+{
+  int64_t fetched_cnt = 0;
+  auto get_datum = [&](const int64_t idx, const ObDatum *&datum) {
+    ++fetched_cnt;
+    datum = &datums[idx];
+    return OB_SUCCESS;
+  };
+  const Frame last_frame = queue.frame_;
+  ASSERT_EQ(OB_SUCCESS, queue.slide(frame, get_datum, val));
+  ASSERT_EQ(frame.head_, queue.frame_.head_);
+  ASSERT_EQ(frame.tail_, queue.frame_.tail_);
+  // rows already pushed are not fetched again when the frame slides forward
+  if (-1 != last_frame.head_ && frame.head_ >= last_frame.head_
+      && frame.tail_ >= last_frame.tail_ && frame.head_ <= last_frame.tail_) {
+    ASSERT_EQ(frame.tail_ - last_frame.tail_, fetched_cnt);
+  } else {
+    ASSERT_EQ(frame.tail_ - frame.head_ + 1, fetched_cnt);
+  }
+  is_null = val.is_null();
+}
+
+void TestExtremumQueue::check_int_frames(const bool is_max, const int64_t preceding,
+                                         const int64_t following)
+{
+  int64_t values[ROW_CNT];
+  ObDatum datums[ROW_CNT];
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    // monotone runs with duplicates and nulls
+    values[i] = (i / 50) % 2 == 0 ? i / 3 : -(i / 3);
+    datums[i].ptr_ = reinterpret_cast<const char *>(values + i);
+    if (0 == i % 17) {
+      datums[i].set_null();
+    } else {
+      datums[i].set_int(values[i]);
+    }
+  }
+  ExtremumQueue queue(allocator_, int_cmp_, is_max);
+  queue.reuse();
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    const Frame frame(std::max(0L, i - preceding), std::min(ROW_CNT - 1, i + following));
+    bool is_null = false;
+    ObDatum val;
+    slide(queue, datums, frame, is_null, val);
+    bool expect_null = true;
+    int64_t expect = 0;
+    for (int64_t j = frame.head_; j <= frame.tail_; ++j) {
+      if (!datums[j].is_null()) {
+        if (expect_null || (is_max ? values[j] > expect : values[j] < expect)) {
+          expect = values[j];
+        }
+        expect_null = false;
+      }
+    }
+    ASSERT_EQ(expect_null, is_null) << "row: " << i;
+    if (!expect_null) {
+      ASSERT_EQ(expect, val.get_int()) << "row: " << i;
+    }
+    // the queue never holds more rows than the frame
+    ASSERT_LE(queue.cnt_, frame.tail_ - frame.head_ + 1);
+  }
+}
+
+TEST_F(TestExtremumQueue, sliding_int)
+{
+  check_int_frames(true, 5, 0);
+  check_int_frames(false, 5, 0);
+  check_int_frames(true, 0, 7);
+  check_int_frames(false, 3, 3);
+  // single row frames, null rows get null results
+  check_int_frames(true, 0, 0);
+  check_int_frames(false, 100, 100);
+}
+
+TEST_F(TestExtremumQueue, frame_not_forward)
+{
+  int64_t values[] = { 5, 1, 9, 3, 7, 2 };
+  ObDatum datums[6];
+  for (int64_t i = 0; i < 6; ++i) {
+    datums[i].ptr_ = reinterpret_cast<const char *>(values + i);
+    datums[i].set_int(values[i]);
+  }
+  ExtremumQueue queue(allocator_, int_cmp_, true);
+  queue.reuse();
+  bool is_null = false;
+  ObDatum val;
+  slide(queue, datums, Frame(0, 3), is_null, val);
+  ASSERT_FALSE(is_null);
+  ASSERT_EQ(9, val.get_int());
+  // frame moves backwards, queue is rebuilt
+  slide(queue, datums, Frame(0, 1), is_null, val);
+  ASSERT_FALSE(is_null);
+  ASSERT_EQ(5, val.get_int());
+  // frame jumps over the pushed rows
+  slide(queue, datums, Frame(4, 5), is_null, val);
+  ASSERT_FALSE(is_null);
+  ASSERT_EQ(7, val.get_int());
+  slide(queue, datums, Frame(5, 5), is_null, val);
+  ASSERT_FALSE(is_null);
+  ASSERT_EQ(2, val.get_int());
+  // new partition
+  queue.reuse();
+  ASSERT_TRUE(queue.is_empty());
+  slide(queue, datums, Frame(1, 2), is_null, val);
+  ASSERT_FALSE(is_null);
+  ASSERT_EQ(9, val.get_int());
+}
+
+TEST_F(TestExtremumQueue, get_datum_failed)
+{
+  int64_t values[] = { 5, 1, 9 };
+  ObDatum datums[3];
+  for (int64_t i = 0; i < 3; ++i) {
+    datums[i].ptr_ = reinterpret_cast<const char *>(values + i);
+    datums[i].set_int(values[i]);
+  }
+  auto get_datum = [&](const int64_t idx, const ObDatum *&datum) {
+    datum = &datums[idx];
+    return 2 == idx ? OB_ERR_UNEXPECTED : OB_SUCCESS;
+  };
+  ExtremumQueue queue(allocator_, int_cmp_, true);
+  queue.reuse();
+  ObDatum val;
+  ASSERT_EQ(OB_SUCCESS, queue.slide(Frame(0, 1), get_datum, val));
+  ASSERT_EQ(5, val.get_int());
+  ASSERT_EQ(OB_ERR_UNEXPECTED, queue.slide(Frame(0, 2), get_datum, val));
+  // frame is not moved on failure
+  ASSERT_EQ(1, queue.frame_.tail_);
+}
+
+TEST_F(TestExtremumQueue, string_deep_copy)
+{
+  const int64_t cnt = 200;
+  char bufs[cnt][32];
+  ObDatum datums[cnt];
+  for (int64_t i = 0; i < cnt; ++i) {
+    // variable length values, longer ones expand the item buffers
+    const int64_t len = snprintf(bufs[i], sizeof(bufs[i]), "%0*ld", static_cast<int>(1 + i % 20),
+                                 (i * 7919) % 1000);
+    datums[i].set_string(bufs[i], static_cast<int32_t>(len));
+  }
+  ExtremumQueue queue(allocator_, str_cmp_, false);
+  queue.reuse();
+  for (int64_t i = 0; i < cnt; ++i) {
+    const Frame frame(std::max(0L, i - 9), i);
+    bool is_null = false;
+    ObDatum val;
+    slide(queue, datums, frame, is_null, val);
+    ASSERT_FALSE(is_null);
+    const ObDatum *expect = &datums[frame.head_];
+    for (int64_t j = frame.head_ + 1; j <= frame.tail_; ++j) {
+      int cmp_ret = 0;
+      ASSERT_EQ(OB_SUCCESS, str_cmp_(datums[j], *expect, cmp_ret));
+      if (cmp_ret < 0) {
+        expect = &datums[j];
+      }
+    }
+    ASSERT_EQ(expect->get_string(), val.get_string()) << "row: " << i;
+    // queue keeps its own copy of the values
+    ASSERT_NE(bufs[i], val.ptr_);
+  }
+  // source rows are overwritten, queued values are unchanged
+  const ObString front = queue.front().get_string();
+  ObString saved;
+  ASSERT_EQ(OB_SUCCESS, ob_write_string(allocator_, front, saved));
+  for (int64_t i = 0; i < cnt; ++i) {
+    MEMSET(bufs[i], 'z', sizeof(bufs[i]));
+  }
+  ASSERT_EQ(saved, queue.front().get_string());
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_extremum_queue.log*");
+  OB_LOGGER.set_file_name("test_extremum_queue.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
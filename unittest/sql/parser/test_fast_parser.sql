@@ -261,4 +261,7 @@ select interval '123123 23:23:23.123123' day (9) to second (9) R from dual;
 select interval '123123 23:23:23.123123' day(9)to second(9) R from dual;
 select interval '12 23:23:23.123123' day to second(6) R from dual;
 select interval '12 23:23:23.123123' day to second R from dual;
-select '\103hh\100hh' 'ueuoiuo';
\ No newline at end of file
+select '\103hh\100hh' 'ueuoiuo';
+select 'abcdefghijklmnopqrstuvwxyz0123456789' from dual;
+select 'abcdefghijklmno\'pqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz' from dual;
+insert into t1 values ('0123456789abcdef', "0123456789abcdef\\0123456789abcdef", 'abcdefghijklmnop''qrstuvwxyz');
@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX SQL
+
+#include <gtest/gtest.h>
+#define private public
+#include "sql/parser/ob_parser.h"
+#include "lib/allocator/page_arena.h"
+#include "lib/worker.h"
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+using namespace oceanbase::sql;
+
+namespace test
+{
+
+class TestInsertMultiValues : public ::testing::Test
+{
+public:
+  TestInsertMultiValues() : allocator_(ObModIds::TEST) {}
+  virtual ~TestInsertMultiValues() {}
+protected:
+  bool may_have_multi_values(const char *sql, const ObSQLMode mode = SMO_DEFAULT);
+  bool is_insert(const char *sql);
+protected:
+  ObArenaAllocator allocator_;
+};
+
+bool TestInsertMultiValues::may_have_multi_values(const char *sql, const ObSQLMode mode)
+{
+  ObParser parser(allocator_, mode);
+  return parser.may_have_multi_values(ObString::make_string(sql));
+}
+
+bool TestInsertMultiValues::is_insert(const char *sql)
+{
+  bool is_ins = false;
+  ObParser parser(allocator_, SMO_DEFAULT);
+  ObSEArray<ObString, 1> queries;
+  EXPECT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string(sql)));
+  EXPECT_EQ(OB_SUCCESS, parser.check_is_insert(queries, is_ins));
+  return is_ins;
+}
+
+TEST_F(TestInsertMultiValues, single_and_multi_values)
+{
+  lib::CompatModeGuard g(lib::Worker::CompatMode::MYSQL);
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, 2)"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1(c1, c2) values (1, (2))"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, f(2, 3))"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1 select * from t2"));
+  ASSERT_TRUE(may_have_multi_values("insert into t1 values (1, 2),(3, 4)"));
+  ASSERT_TRUE(may_have_multi_values("insert into t1(c1, c2) values (1, 2) ,\n (3, 4), (5, 6)"));
+  ASSERT_TRUE(may_have_multi_values("replace into t1 values ((1), 2), (3, 4)"));
+}
+
+TEST_F(TestInsertMultiValues, literal_and_comment)
+{
+  lib::CompatModeGuard g(lib::Worker::CompatMode::MYSQL);
+  // ')' and ',' inside literals
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, '),(')"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, \"),(\")"));
+  ASSERT_FALSE(may_have_multi_values("insert into `t),(` values (1, 2)"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, 'a\\'),(b')"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, 'a''),(b')"));
+  ASSERT_TRUE(may_have_multi_values("insert into t1 values (1, '),('), (2, ',')"));
+  // ')' and ',' inside comments
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1 /* ),( */, 2)"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, 2 -- ),(\n)"));
+  ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, 2 # ),(\n)"));
+  ASSERT_FALSE(may_have_multi_values("insert /*+ ),( */ into t1 values (1, 2)"));
+  // comment between ')' and ',' is treated as multi values, the parse decides
+  ASSERT_TRUE(may_have_multi_values("insert into t1 values (1, 2) /* c */, (3, 4)"));
+}
+
+TEST_F(TestInsertMultiValues, on_duplicate_key_update)
+{
+  lib::CompatModeGuard g(lib::Worker::CompatMode::MYSQL);
+  ASSERT_FALSE(may_have_multi_values(
+      "insert into t1 values (1, 2) on duplicate key update c2 = values(c2) + 1"));
+  ASSERT_TRUE(may_have_multi_values(
+      "insert into t1 values (1, 2), (3, 4) on duplicate key update c2 = c2 + 1"));
+  // false positive, falls back to the INS_MULTI_VALUES parse
+  ASSERT_TRUE(may_have_multi_values(
+      "insert into t1 values (1, 2) on duplicate key update c1 = values(c1), c2 = values(c2)"));
+}
+
+TEST_F(TestInsertMultiValues, backslash_escapes)
+{
+  const char *sql = "insert into t1 values (1, 'a\\'),(b')";
+  {
+    lib::CompatModeGuard g(lib::Worker::CompatMode::MYSQL);
+    // 'a\'),(b' is one literal
+    ASSERT_FALSE(may_have_multi_values(sql));
+    // 'a\' is one literal followed by ),(
+    ASSERT_TRUE(may_have_multi_values(sql, SMO_NO_BACKSLASH_ESCAPES));
+    // escaped backslash does not escape the quote
+    ASSERT_TRUE(may_have_multi_values("insert into t1 values (1, 'a\\\\'),(b')"));
+  }
+  {
+    // backslash is not an escape in oracle mode
+    lib::CompatModeGuard g(lib::Worker::CompatMode::ORACLE);
+    ASSERT_TRUE(may_have_multi_values(sql));
+    ASSERT_TRUE(may_have_multi_values("insert into t1 values (1, \"a\\\"),(b\")"));
+    ASSERT_FALSE(may_have_multi_values("insert into t1 values (1, 'a\\'',' b)"));
+    // '#' does not start a comment in oracle mode
+    ASSERT_TRUE(may_have_multi_values("insert into t1 values (1, 2 # 3), (4, 5)"));
+  }
+}
+
+TEST_F(TestInsertMultiValues, leading_comment)
+{
+  ASSERT_TRUE(is_insert("insert into t1 values (1)"));
+  ASSERT_TRUE(is_insert("REPLACE into t1 values (1)"));
+  ASSERT_TRUE(is_insert("  \n\tinsert into t1 values (1)"));
+  ASSERT_TRUE(is_insert("/* loader */ insert into t1 values (1)"));
+  ASSERT_TRUE(is_insert("/**/insert into t1 values (1)"));
+  ASSERT_TRUE(is_insert(" /* a */\n/* b */ replace into t1 values (1)"));
+  ASSERT_FALSE(is_insert("select 1"));
+  ASSERT_FALSE(is_insert("/* insert */ select 1"));
+  // hints and executable comments are not skipped
+  ASSERT_FALSE(is_insert("/*+ parallel(2) */ insert into t1 values (1)"));
+  ASSERT_FALSE(is_insert("/*!40101 insert */ insert into t1 values (1)"));
+  // unterminated comment
+  ASSERT_FALSE(is_insert("/* insert into t1 values (1)"));
+  ASSERT_FALSE(is_insert("/* loader *"));
+  // multi query is never folded
+  bool is_ins = true;
+  ObParser parser(allocator_, SMO_DEFAULT);
+  ObSEArray<ObString, 2> queries;
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("insert into t1 values (1)")));
+  ASSERT_EQ(OB_SUCCESS, queries.push_back(ObString::make_string("insert into t1 values (2)")));
+  ASSERT_EQ(OB_SUCCESS, parser.check_is_insert(queries, is_ins));
+  ASSERT_FALSE(is_ins);
+}
+
+} // end namespace test
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_insert_multi_values.log*");
+  OB_LOGGER.set_file_name("test_insert_multi_values.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/random/ob_random.h"
+#include "storage/blocksstable/encoding/ob_raw_decoder.h"
+#include "storage/blocksstable/encoding/ob_integer_array.h"
+#include "storage/blocksstable/encoding/ob_integer_base_diff_decoder.h"
+#include "storage/blocksstable/encoding/ob_string_diff_decoder.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+
+namespace unittest
+{
+
+// Benchmark of the scalar and dispatched (SIMD if cpu supports) batch kernels
+// of column decoders. Not registered in ctest, run it by hand:
+//   ./decoder_simd_perf [--gtest_filter=*rle*]
+// Correctness of the kernels is covered by test_decoder_simd.
+class DecoderSimdPerf : public ::testing::Test
+{
+public:
+  static const int64_t ROW_CNT = 4096;
+  static const int64_t LOOP_CNT = 2000;
+  DecoderSimdPerf() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp();
+  virtual void TearDown() { allocator_.reset(); }
+protected:
+  unsigned char *data_;
+  uint64_t *scalar_values_;
+  uint64_t *simd_values_;
+  ObArenaAllocator allocator_;
+};
+
+void DecoderSimdPerf::SetUp()
+{
+  ObRandom random;
+  data_ = static_cast<unsigned char *>(allocator_.alloc(ROW_CNT * sizeof(uint64_t)));
+  scalar_values_ = static_cast<uint64_t *>(allocator_.alloc(ROW_CNT * sizeof(uint64_t)));
+  simd_values_ = static_cast<uint64_t *>(allocator_.alloc(ROW_CNT * sizeof(uint64_t)));
+  ASSERT_TRUE(nullptr != data_ && nullptr != scalar_values_ && nullptr != simd_values_);
+  for (int64_t i = 0; i < ROW_CNT * static_cast<int64_t>(sizeof(uint64_t)); ++i) {
+    data_[i] = static_cast<unsigned char>(random.get(0, 16));
+  }
+}
+
+void print_cost(const char *name, const int64_t len_tag,
+                const int64_t scalar_cost, const int64_t simd_cost)
+{
+  STORAGE_LOG(INFO, "decoder kernel cost", K(name), K(len_tag), K(scalar_cost), K(simd_cost));
+  std::cout << name << " len_tag=" << len_tag << " scalar=" << scalar_cost << "us simd="
+            << simd_cost << "us" << std::endl;
+}
+
+template <int32_t LEN_TAG>
+void run_int_diff_unpack(const unsigned char *data, uint64_t *scalar_values, uint64_t *simd_values)
+{
+  const uint64_t base = 1000000007;
+  const int64_t row_cnt = DecoderSimdPerf::ROW_CNT;
+  int64_t start_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < DecoderSimdPerf::LOOP_CNT; ++i) {
+    IntDiffFixUnpackFunc_T<LEN_TAG>::fix_unpack_func(data, 0, row_cnt, base, scalar_values);
+  }
+  const int64_t scalar_cost = ObTimeUtility::current_time() - start_time;
+  start_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < DecoderSimdPerf::LOOP_CNT; ++i) {
+    int_diff_fix_unpack_funcs[LEN_TAG](data, 0, row_cnt, base, simd_values);
+  }
+  const int64_t simd_cost = ObTimeUtility::current_time() - start_time;
+  ASSERT_EQ(0, MEMCMP(scalar_values, simd_values, row_cnt * sizeof(uint64_t)));
+  print_cost("int diff unpack", LEN_TAG, scalar_cost, simd_cost);
+}
+
+// Scalar side is the ref loop the RLE and const decoders fall back to
+template <int32_t LEN_TAG>
+void run_ref_eq(const char *name, const unsigned char *data, const int64_t ref_cnt)
+{
+  const int64_t ref_byte = 1L << LEN_TAG;
+  const int64_t ref = 3;
+  const int64_t size = sql::ObBitVector::memory_size(ref_cnt);
+  char scalar_buf[size];
+  char simd_buf[size];
+  sql::ObBitVector *scalar_res = sql::to_bit_vector(scalar_buf);
+  sql::ObBitVector *simd_res = sql::to_bit_vector(simd_buf);
+  const ObIntArrayFuncTable &refs = ObIntArrayFuncTable::instance(ref_byte);
+  int64_t start_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < DecoderSimdPerf::LOOP_CNT; ++i) {
+    scalar_res->init(ref_cnt);
+    for (int64_t pos = 0; pos < ref_cnt; ++pos) {
+      if (refs.at_(data, pos) == ref) {
+        scalar_res->set(pos);
+      }
+    }
+  }
+  const int64_t scalar_cost = ObTimeUtility::current_time() - start_time;
+  start_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < DecoderSimdPerf::LOOP_CNT; ++i) {
+    simd_res->init(ref_cnt);
+    raw_fix_fast_filter_funcs[0][LEN_TAG][sql::WHITE_OP_EQ](
+        ref_cnt, data, static_cast<uint64_t>(ref), *simd_res);
+  }
+  const int64_t simd_cost = ObTimeUtility::current_time() - start_time;
+  ASSERT_EQ(0, MEMCMP(scalar_buf, simd_buf, size));
+  print_cost(name, LEN_TAG, scalar_cost, simd_cost);
+}
+
+// Integer base diff projection
+TEST_F(DecoderSimdPerf, int_diff_unpack)
+{
+  ASSERT_TRUE(int_diff_fix_unpack_funcs_inited);
+  run_int_diff_unpack<0>(data_, scalar_values_, simd_values_);
+  run_int_diff_unpack<1>(data_, scalar_values_, simd_values_);
+  run_int_diff_unpack<2>(data_, scalar_values_, simd_values_);
+  run_int_diff_unpack<3>(data_, scalar_values_, simd_values_);
+}
+
+// RLE pushdown equal filter over the run refs of each ref byte
+TEST_F(DecoderSimdPerf, rle_run_ref_eq)
+{
+  ASSERT_TRUE(raw_fix_fast_filter_funcs_inited);
+  run_ref_eq<0>("rle run ref eq", data_, ROW_CNT);
+  run_ref_eq<1>("rle run ref eq", data_, ROW_CNT);
+  run_ref_eq<2>("rle run ref eq", data_, ROW_CNT);
+  run_ref_eq<3>("rle run ref eq", data_, ROW_CNT);
+}
+
+// Const pushdown equal filter over the exception refs, always stored in 1 byte
+TEST_F(DecoderSimdPerf, const_exception_ref_eq)
+{
+  ASSERT_TRUE(raw_fix_fast_filter_funcs_inited);
+  run_ref_eq<0>("const exception ref eq", data_, ROW_CNT);
+  run_ref_eq<0>("const exception ref eq", data_, 100);
+}
+
+// String diff projection
+TEST_F(DecoderSimdPerf, string_diff_short_batch)
+{
+  ASSERT_TRUE(string_diff_short_batch_func_inited);
+  const int64_t row_cnt = ROW_CNT;
+  const int64_t cell_len = 6;
+  const int64_t string_size = 19;
+  const int64_t buf_size = 128;
+  // "2022-10-17 12:xx:xx" like strings, diff bytes are 11,12,14,15,17,18
+  char tmpl[ObStringDiffDecoder::SHORT_STRING_SIZE] = "2022-10-17 00:00:00";
+  uint8_t shuffle_idx[ObStringDiffDecoder::SHORT_STRING_SIZE];
+  MEMSET(shuffle_idx, 0x80, sizeof(shuffle_idx));
+  const int64_t diff_pos[] = {11, 12, 14, 15, 17, 18};
+  for (int64_t i = 0; i < cell_len; ++i) {
+    shuffle_idx[diff_pos[i]] = static_cast<uint8_t>(i);
+    tmpl[diff_pos[i]] = 0;
+  }
+  for (int64_t i = string_size; i < ObStringDiffDecoder::SHORT_STRING_SIZE; ++i) {
+    tmpl[i] = 0;
+  }
+  int64_t *row_ids = static_cast<int64_t *>(allocator_.alloc(row_cnt * sizeof(int64_t)));
+  ObDatum *scalar_datums = static_cast<ObDatum *>(allocator_.alloc(row_cnt * sizeof(ObDatum)));
+  ObDatum *simd_datums = static_cast<ObDatum *>(allocator_.alloc(row_cnt * sizeof(ObDatum)));
+  char *scalar_buf = static_cast<char *>(allocator_.alloc(row_cnt * buf_size));
+  char *simd_buf = static_cast<char *>(allocator_.alloc(row_cnt * buf_size));
+  ASSERT_TRUE(nullptr != row_ids && nullptr != scalar_datums && nullptr != simd_datums
+      && nullptr != scalar_buf && nullptr != simd_buf);
+  const int64_t cell_cnt = ROW_CNT * static_cast<int64_t>(sizeof(uint64_t)) / cell_len;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    row_ids[i] = i % cell_cnt;
+    new (scalar_datums + i) ObDatum();
+    new (simd_datums + i) ObDatum();
+  }
+
+  int64_t start_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < LOOP_CNT; ++i) {
+    StringDiffShortBatchFunc_T::short_batch_func(tmpl, shuffle_idx, data_, cell_len,
+        string_size, row_ids, row_cnt, false, buf_size, scalar_buf, scalar_datums);
+  }
+  const int64_t scalar_cost = ObTimeUtility::current_time() - start_time;
+  start_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < LOOP_CNT; ++i) {
+    string_diff_short_batch_decode_func(tmpl, shuffle_idx, data_, cell_len,
+        string_size, row_ids, row_cnt, false, buf_size, simd_buf, simd_datums);
+  }
+  const int64_t simd_cost = ObTimeUtility::current_time() - start_time;
+  for (int64_t i = 0; i < row_cnt; ++i) {
+    ASSERT_EQ(string_size, simd_datums[i].len_);
+    ASSERT_EQ(0, MEMCMP(scalar_datums[i].ptr_, simd_datums[i].ptr_, string_size));
+  }
+  print_cost("string diff short batch", 0, scalar_cost, simd_cost);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f decoder_simd_perf.log*");
+  OB_LOGGER.set_file_name("decoder_simd_perf.log", true, true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
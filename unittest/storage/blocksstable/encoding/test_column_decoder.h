@@ -85,6 +85,8 @@ public:
 
   void basic_filter_pushdown_bt_test();
 
+  void basic_filter_pushdown_like_test();
+
   void filter_pushdown_comaprison_neg_test();
 
   void batch_decode_to_datum_test(bool is_condensed = false);
@@ -339,6 +341,8 @@ int TestColumnDecoder::test_filter_pushdown(
   filter.params_ = objs;
   if (sql::WHITE_OP_IN == filter.get_op_type()) {
     filter.init_obj_set();
+  } else if (sql::WHITE_OP_LI == filter.get_op_type()) {
+    filter.init_like_pattern();
   }
 
   if (is_retro) {
@@ -840,6 +844,82 @@ void TestColumnDecoder::basic_filter_pushdown_bt_test()
   }
 }
 
+void TestColumnDecoder::basic_filter_pushdown_like_test()
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  const char *values[] = {"logerror: disk full", "logerror: timeout", "loginfo: started", "trace: 100%"};
+  int64_t seed = 10000;
+  for (int64_t i = 0; i < ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(seed, row));
+    for (int64_t j = 0; j < full_column_cnt_; ++j) {
+      if (ObVarcharType != col_descs_.at(j).col_type_.get_type()) {
+      } else if (0 == i % 8) {
+        row.storage_datums_[j].set_null();
+      } else {
+        row.storage_datums_[j].set_string(values[i % 4], static_cast<int32_t>(strlen(values[i % 4])));
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_)) << "buffer size: " << data.get_buf_size() << std::endl;
+
+  struct LikeCase
+  {
+    const char *pattern_;
+    ObCollationType cs_type_;
+    int64_t expected_;
+  };
+  // 8 null rows, 8 rows of values[0] and 16 rows of each other value
+  const LikeCase cases[] = {
+    {"logerror%", CS_TYPE_UTF8MB4_GENERAL_CI, 24},
+    {"LOGERROR%", CS_TYPE_UTF8MB4_GENERAL_CI, 24},
+    {"logerror%", CS_TYPE_BINARY, 24},
+    {"LOGERROR%", CS_TYPE_BINARY, 0},
+    {"log%%", CS_TYPE_BINARY, 40},
+    {"%timeout", CS_TYPE_UTF8MB4_GENERAL_CI, 16},
+    {"log_nfo%", CS_TYPE_UTF8MB4_GENERAL_CI, 16},
+    {"trace: 100\\%", CS_TYPE_UTF8MB4_GENERAL_CI, 16},
+    {"%", CS_TYPE_BINARY, 56},
+    {"nothing%", CS_TYPE_BINARY, 0},
+  };
+
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    if (ObVarcharType != col_descs_.at(i).col_type_.get_type()) {
+      continue;
+    }
+    sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+    white_filter.op_type_ = sql::WHITE_OP_LI;
+    int32_t col_idx = i;
+    ObBitmap result_bitmap(allocator_);
+    result_bitmap.init(ROW_CNT);
+    for (int64_t j = 0; j < ARRAYSIZEOF(cases); ++j) {
+      ObMalloc mallocer;
+      mallocer.set_label("ColumnDecoder");
+      ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 2);
+      objs.init(2);
+      ObObj pattern;
+      ObObj escape;
+      pattern.set_varchar(cases[j].pattern_);
+      pattern.set_collation_type(cases[j].cs_type_);
+      escape.set_null();
+      objs.push_back(pattern);
+      objs.push_back(escape);
+
+      result_bitmap.reuse();
+      ASSERT_EQ(0, result_bitmap.popcnt());
+      ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(col_idx, is_retro_, decoder, white_filter, result_bitmap, objs));
+      ASSERT_EQ(cases[j].expected_, result_bitmap.popcnt()) << "pattern: " << cases[j].pattern_ << std::endl;
+    }
+  }
+}
+
 void TestColumnDecoder::batch_decode_to_datum_test(bool is_condensed)
 {
   ObDatumRow row;
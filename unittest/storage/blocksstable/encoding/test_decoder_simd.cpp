@@ -0,0 +1,461 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include <gtest/gtest.h>
+#define protected public
+#define private public
+#include "test_column_decoder.h"
+#include "lib/random/ob_random.h"
+#include "storage/blocksstable/encoding/ob_raw_decoder.h"
+#include "storage/blocksstable/encoding/ob_integer_base_diff_decoder.h"
+#include "storage/blocksstable/encoding/ob_string_diff_decoder.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+using namespace common;
+using namespace storage;
+using namespace share::schema;
+
+// Dispatched (SIMD if cpu supports) batch kernels of column decoders must give
+// the same result as the scalar templates
+class TestDecoderSimdKernel : public ::testing::Test
+{
+public:
+  static const int64_t ROW_CNT = 1024;
+  TestDecoderSimdKernel() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp();
+  virtual void TearDown() { allocator_.reset(); }
+protected:
+  unsigned char *data_;
+  uint64_t *scalar_values_;
+  uint64_t *simd_values_;
+  ObArenaAllocator allocator_;
+};
+
+void TestDecoderSimdKernel::SetUp()
+{
+  ObRandom random;
+  data_ = static_cast<unsigned char *>(allocator_.alloc(ROW_CNT * sizeof(uint64_t)));
+  scalar_values_ = static_cast<uint64_t *>(allocator_.alloc(ROW_CNT * sizeof(uint64_t)));
+  simd_values_ = static_cast<uint64_t *>(allocator_.alloc(ROW_CNT * sizeof(uint64_t)));
+  ASSERT_TRUE(nullptr != data_ && nullptr != scalar_values_ && nullptr != simd_values_);
+  for (int64_t i = 0; i < ROW_CNT * static_cast<int64_t>(sizeof(uint64_t)); ++i) {
+    data_[i] = static_cast<unsigned char>(random.get(0, 16));
+  }
+}
+
+template <int32_t LEN_TAG>
+void check_int_diff_unpack(
+    const unsigned char *data,
+    const int64_t row_start,
+    const int64_t row_cnt,
+    const uint64_t base,
+    uint64_t *scalar_values,
+    uint64_t *simd_values)
+{
+  MEMSET(scalar_values, 0, row_cnt * sizeof(uint64_t));
+  MEMSET(simd_values, 0, row_cnt * sizeof(uint64_t));
+  IntDiffFixUnpackFunc_T<LEN_TAG>::fix_unpack_func(data, row_start, row_cnt, base, scalar_values);
+  int_diff_fix_unpack_funcs[LEN_TAG](data, row_start, row_cnt, base, simd_values);
+  ASSERT_EQ(0, MEMCMP(scalar_values, simd_values, row_cnt * sizeof(uint64_t)))
+      << "len_tag: " << LEN_TAG << " row_start: " << row_start << " row_cnt: " << row_cnt;
+}
+
+template <int32_t LEN_TAG>
+void check_int_diff_unpack(const unsigned char *data, uint64_t *scalar_values, uint64_t *simd_values)
+{
+  const int64_t row_cnt = TestDecoderSimdKernel::ROW_CNT;
+  // aligned and unaligned start rows, tail rows less than a vector
+  const int64_t ranges[][2] = {{0, row_cnt}, {3, 37}, {1, 1}, {7, 64}, {row_cnt - 17, 17}};
+  for (int64_t i = 0; i < ARRAYSIZEOF(ranges); ++i) {
+    check_int_diff_unpack<LEN_TAG>(data, ranges[i][0], ranges[i][1], 1000000007,
+                                   scalar_values, simd_values);
+    // base + delta overflows
+    check_int_diff_unpack<LEN_TAG>(data, ranges[i][0], ranges[i][1], UINT64_MAX - 5,
+                                   scalar_values, simd_values);
+  }
+}
+
+template <int32_t LEN_TAG, int32_t CMP_TYPE>
+void check_fix_filter(const unsigned char *data, const int64_t row_cnt, const uint64_t node_value)
+{
+  const int64_t size = sql::ObBitVector::memory_size(row_cnt);
+  char scalar_buf[size];
+  char simd_buf[size];
+  sql::ObBitVector *scalar_res = sql::to_bit_vector(scalar_buf);
+  sql::ObBitVector *simd_res = sql::to_bit_vector(simd_buf);
+  scalar_res->reset(row_cnt);
+  simd_res->reset(row_cnt);
+  RawFixFilterFunc_T<0, LEN_TAG, CMP_TYPE>::fix_filter_func(row_cnt, data, node_value, *scalar_res);
+  raw_fix_fast_filter_funcs[0][LEN_TAG][CMP_TYPE](row_cnt, data, node_value, *simd_res);
+  ASSERT_EQ(0, MEMCMP(scalar_buf, simd_buf, size))
+      << "len_tag: " << LEN_TAG << " cmp_type: " << CMP_TYPE << " row_cnt: " << row_cnt;
+}
+
+template <int32_t LEN_TAG>
+void check_fix_filter(const unsigned char *data, const int64_t row_cnt, const uint64_t node_value)
+{
+  check_fix_filter<LEN_TAG, sql::WHITE_OP_EQ>(data, row_cnt, node_value);
+  check_fix_filter<LEN_TAG, sql::WHITE_OP_LE>(data, row_cnt, node_value);
+  check_fix_filter<LEN_TAG, sql::WHITE_OP_LT>(data, row_cnt, node_value);
+  check_fix_filter<LEN_TAG, sql::WHITE_OP_GE>(data, row_cnt, node_value);
+  check_fix_filter<LEN_TAG, sql::WHITE_OP_GT>(data, row_cnt, node_value);
+  check_fix_filter<LEN_TAG, sql::WHITE_OP_NE>(data, row_cnt, node_value);
+}
+
+template <int32_t LEN_TAG>
+void check_fix_filter(const unsigned char *data)
+{
+  typedef typename ObEncodingTypeInference<0, LEN_TAG>::Type DataType;
+  const DataType *values = reinterpret_cast<const DataType *>(data);
+  const int64_t row_cnts[] = {TestDecoderSimdKernel::ROW_CNT, 1, 63, 65, 100};
+  for (int64_t i = 0; i < ARRAYSIZEOF(row_cnts); ++i) {
+    // value exists in data, min value and max value of the type
+    check_fix_filter<LEN_TAG>(data, row_cnts[i], static_cast<uint64_t>(values[row_cnts[i] / 2]));
+    check_fix_filter<LEN_TAG>(data, row_cnts[i], 0);
+    check_fix_filter<LEN_TAG>(data, row_cnts[i], static_cast<uint64_t>(static_cast<DataType>(-1)));
+  }
+}
+
+// Used by integer base diff projection
+TEST_F(TestDecoderSimdKernel, int_diff_unpack)
+{
+  ASSERT_TRUE(int_diff_fix_unpack_funcs_inited);
+  check_int_diff_unpack<0>(data_, scalar_values_, simd_values_);
+  check_int_diff_unpack<1>(data_, scalar_values_, simd_values_);
+  check_int_diff_unpack<2>(data_, scalar_values_, simd_values_);
+  check_int_diff_unpack<3>(data_, scalar_values_, simd_values_);
+}
+
+// Used by integer base diff filter, RLE run refs and const exception refs
+TEST_F(TestDecoderSimdKernel, fix_filter)
+{
+  ASSERT_TRUE(raw_fix_fast_filter_funcs_inited);
+  check_fix_filter<0>(data_);
+  check_fix_filter<1>(data_);
+  check_fix_filter<2>(data_);
+  check_fix_filter<3>(data_);
+}
+
+// Used by string diff projection
+TEST_F(TestDecoderSimdKernel, string_diff_short_batch)
+{
+  ASSERT_TRUE(string_diff_short_batch_func_inited);
+  const int64_t row_cnt = ROW_CNT;
+  const int64_t cell_len = 6;
+  const int64_t string_size = 19;
+  const int64_t buf_size = 128;
+  // "2022-10-17 12:xx:xx" like strings, diff bytes are 11,12,14,15,17,18
+  char tmpl[ObStringDiffDecoder::SHORT_STRING_SIZE] = "2022-10-17 00:00:00";
+  uint8_t shuffle_idx[ObStringDiffDecoder::SHORT_STRING_SIZE];
+  MEMSET(shuffle_idx, 0x80, sizeof(shuffle_idx));
+  const int64_t diff_pos[] = {11, 12, 14, 15, 17, 18};
+  for (int64_t i = 0; i < cell_len; ++i) {
+    shuffle_idx[diff_pos[i]] = static_cast<uint8_t>(i);
+    tmpl[diff_pos[i]] = 0;
+  }
+  for (int64_t i = string_size; i < ObStringDiffDecoder::SHORT_STRING_SIZE; ++i) {
+    tmpl[i] = 0;
+  }
+  int64_t *row_ids = static_cast<int64_t *>(allocator_.alloc(row_cnt * sizeof(int64_t)));
+  ObDatum *scalar_datums = static_cast<ObDatum *>(allocator_.alloc(row_cnt * sizeof(ObDatum)));
+  ObDatum *simd_datums = static_cast<ObDatum *>(allocator_.alloc(row_cnt * sizeof(ObDatum)));
+  char *scalar_buf = static_cast<char *>(allocator_.alloc(row_cnt * buf_size));
+  char *simd_buf = static_cast<char *>(allocator_.alloc(row_cnt * buf_size));
+  ASSERT_TRUE(nullptr != row_ids && nullptr != scalar_datums && nullptr != simd_datums
+      && nullptr != scalar_buf && nullptr != simd_buf);
+  const int64_t cell_cnt = ROW_CNT * static_cast<int64_t>(sizeof(uint64_t)) / cell_len;
+  for (int64_t has_null = 0; has_null < 2; ++has_null) {
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      // unordered row ids
+      row_ids[i] = (i * 7) % cell_cnt;
+      new (scalar_datums + i) ObDatum();
+      new (simd_datums + i) ObDatum();
+      if (has_null && 0 == i % 5) {
+        scalar_datums[i].set_null();
+        simd_datums[i].set_null();
+      }
+    }
+    StringDiffShortBatchFunc_T::short_batch_func(tmpl, shuffle_idx, data_, cell_len,
+        string_size, row_ids, row_cnt, has_null, buf_size, scalar_buf, scalar_datums);
+    string_diff_short_batch_decode_func(tmpl, shuffle_idx, data_, cell_len,
+        string_size, row_ids, row_cnt, has_null, buf_size, simd_buf, simd_datums);
+    for (int64_t i = 0; i < row_cnt; ++i) {
+      ASSERT_EQ(scalar_datums[i].is_null(), simd_datums[i].is_null()) << "i: " << i;
+      if (!scalar_datums[i].is_null()) {
+        ASSERT_EQ(string_size, simd_datums[i].len_);
+        ASSERT_EQ(0, MEMCMP(scalar_datums[i].ptr_, simd_datums[i].ptr_, string_size)) << "i: " << i;
+      }
+    }
+  }
+}
+
+class TestIntDiffDecoderSimd : public TestColumnDecoder
+{
+public:
+  static const int64_t BLOCK_ROW_CNT = 320;
+  static const int64_t BASE_VALUE = 1000;
+  TestIntDiffDecoderSimd() : TestColumnDecoder(ObColumnHeader::Type::INTEGER_BASE_DIFF) {}
+  virtual ~TestIntDiffDecoderSimd() {}
+  int64_t get_int_col_idx() const;
+  void check_filter(ObMicroBlockDecoder &decoder,
+                    const int64_t col_idx,
+                    const sql::ObWhiteFilterOperatorType op_type,
+                    const int64_t param);
+};
+
+int64_t TestIntDiffDecoderSimd::get_int_col_idx() const
+{
+  int64_t col_idx = -1;
+  for (int64_t i = 0; col_idx < 0 && i < col_descs_.count(); ++i) {
+    if (ObIntType == col_descs_.at(i).col_type_.get_type()) {
+      col_idx = i;
+    }
+  }
+  return col_idx;
+}
+
+void TestIntDiffDecoderSimd::check_filter(
+    ObMicroBlockDecoder &decoder,
+    const int64_t col_idx,
+    const sql::ObWhiteFilterOperatorType op_type,
+    const int64_t param)
+{
+  sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+  ObMalloc mallocer;
+  mallocer.set_label("IntDiffDecoder");
+  ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 1);
+  ObObj ref_obj;
+  ref_obj.set_int(param);
+  ref_obj.set_collation_type(CS_TYPE_BINARY);
+  ref_obj.set_collation_level(CS_LEVEL_NUMERIC);
+  ASSERT_EQ(OB_SUCCESS, objs.init(1));
+  ASSERT_EQ(OB_SUCCESS, objs.push_back(ref_obj));
+  white_filter.op_type_ = op_type;
+  ObBitmap result_bitmap(allocator_);
+  ASSERT_EQ(OB_SUCCESS, result_bitmap.init(BLOCK_ROW_CNT));
+  ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(col_idx, false, decoder, white_filter, result_bitmap, objs));
+  for (int64_t i = 0; i < BLOCK_ROW_CNT; ++i) {
+    const int64_t value = BASE_VALUE + i % 100;
+    bool expected = false;
+    switch (op_type) {
+      case sql::WHITE_OP_EQ: expected = value == param; break;
+      case sql::WHITE_OP_LE: expected = value <= param; break;
+      case sql::WHITE_OP_LT: expected = value < param; break;
+      case sql::WHITE_OP_GE: expected = value >= param; break;
+      case sql::WHITE_OP_GT: expected = value > param; break;
+      case sql::WHITE_OP_NE: expected = value != param; break;
+      default: break;
+    }
+    ASSERT_EQ(expected, result_bitmap.test(i)) << "op: " << op_type << " param: " << param << " i: " << i;
+  }
+}
+
+// Continuous rows are unpacked by batch_get_fixed_values, compare with decoding row by row
+TEST_F(TestIntDiffDecoderSimd, batch_get_fixed_values)
+{
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < BLOCK_ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i, row));
+    if (0 == i % 17) {
+      for (int64_t j = 0; j < full_column_cnt_; ++j) {
+        row.storage_datums_[j].set_null();
+      }
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  const_cast<bool &>(encoder_.ctx_.encoder_opt_.enable_bit_packing_) = false;
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+
+  const int64_t datum_buf_size = 128;
+  char *datum_buf = static_cast<char *>(allocator_.alloc(datum_buf_size * BLOCK_ROW_CNT));
+  char obj_datum_buf[datum_buf_size];
+  ASSERT_TRUE(nullptr != datum_buf);
+  const char *cell_datas[BLOCK_ROW_CNT];
+  ObDatum datums[BLOCK_ROW_CNT];
+  int64_t row_ids[BLOCK_ROW_CNT];
+  const int64_t ranges[][2] = {{0, BLOCK_ROW_CNT}, {3, 37}, {100, 130}, {BLOCK_ROW_CNT - 2, 2}};
+  int64_t checked_col_cnt = 0;
+  for (int64_t i = 0; i < full_column_cnt_; ++i) {
+    const ObColumnDecoderCtx &col_ctx = *decoder.decoders_[i].ctx_;
+    if (ObColumnHeader::Type::INTEGER_BASE_DIFF != col_ctx.col_header_->type_) {
+      continue;
+    }
+    ASSERT_FALSE(col_ctx.is_bit_packing());
+    ++checked_col_cnt;
+    for (int64_t r = 0; r < ARRAYSIZEOF(ranges); ++r) {
+      const int64_t row_cap = ranges[r][1];
+      for (int64_t j = 0; j < row_cap; ++j) {
+        datums[j].ptr_ = datum_buf + j * datum_buf_size;
+        row_ids[j] = ranges[r][0] + j;
+      }
+      ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].batch_decode(
+          decoder.row_index_, row_ids, cell_datas, row_cap, datums));
+      for (int64_t j = 0; j < row_cap; ++j) {
+        const char *row_data = nullptr;
+        int64_t row_len = 0;
+        ObObj obj;
+        ObDatum datum_from_obj;
+        datum_from_obj.ptr_ = obj_datum_buf;
+        ASSERT_EQ(OB_SUCCESS, decoder.row_index_->get(row_ids[j], row_data, row_len));
+        ObBitStream bs(reinterpret_cast<unsigned char *>(const_cast<char *>(row_data)), row_len);
+        ASSERT_EQ(OB_SUCCESS, decoder.decoders_[i].decode(obj, row_ids[j], bs, row_data, row_len));
+        ASSERT_EQ(OB_SUCCESS, datum_from_obj.from_obj(obj));
+        ASSERT_TRUE(ObDatum::binary_equal(datum_from_obj, datums[j]))
+            << "col: " << i << " row: " << row_ids[j];
+      }
+    }
+  }
+  ASSERT_GT(checked_col_cnt, 0);
+}
+
+// Filter delta larger than the max delta of the cell length, fast_comparison_operator
+// decides the result without running the kernel
+TEST_F(TestIntDiffDecoderSimd, fast_comparison_param_out_of_mask)
+{
+  const int64_t col_idx = get_int_col_idx();
+  ASSERT_GE(col_idx, 0);
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < BLOCK_ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i, row));
+    row.storage_datums_[col_idx].set_int(BASE_VALUE + i % 100);
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  const_cast<bool &>(encoder_.ctx_.encoder_opt_.enable_bit_packing_) = false;
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  const ObColumnDecoderCtx &col_ctx = *decoder.decoders_[col_idx].ctx_;
+  ASSERT_EQ(ObColumnHeader::Type::INTEGER_BASE_DIFF, col_ctx.col_header_->type_);
+  ASSERT_FALSE(col_ctx.is_bit_packing());
+
+  const sql::ObWhiteFilterOperatorType op_types[] = {
+      sql::WHITE_OP_EQ, sql::WHITE_OP_LE, sql::WHITE_OP_LT,
+      sql::WHITE_OP_GE, sql::WHITE_OP_GT, sql::WHITE_OP_NE};
+  // delta out of 1 and 2 bytes, delta in range, max delta, below base
+  const int64_t params[] = {BASE_VALUE + 100000, BASE_VALUE + 50, BASE_VALUE + 99, BASE_VALUE - 1};
+  for (int64_t i = 0; i < ARRAYSIZEOF(op_types); ++i) {
+    for (int64_t j = 0; j < ARRAYSIZEOF(params); ++j) {
+      check_filter(decoder, col_idx, op_types[i], params[j]);
+    }
+  }
+}
+
+class TestRLEDecoderSimd : public TestColumnDecoder
+{
+public:
+  static const int64_t BLOCK_ROW_CNT = 320;
+  static const int64_t RUN_LEN = 37;
+  static const int64_t NULL_START = 100;
+  static const int64_t NULL_END = 110;
+  TestRLEDecoderSimd() : TestColumnDecoder(ObColumnHeader::Type::RLE) {}
+  virtual ~TestRLEDecoderSimd() {}
+};
+
+// Runs are set into the result bitmap word by word with fill_bit_words,
+// compare with the value of each row
+TEST_F(TestRLEDecoderSimd, fill_bit_words)
+{
+  int64_t col_idx = -1;
+  for (int64_t i = 0; col_idx < 0 && i < col_descs_.count(); ++i) {
+    if (ObUInt64Type == col_descs_.at(i).col_type_.get_type()) {
+      col_idx = i;
+    }
+  }
+  ASSERT_GE(col_idx, 0);
+  ObDatumRow row;
+  ASSERT_EQ(OB_SUCCESS, row.init(allocator_, full_column_cnt_));
+  for (int64_t i = 0; i < BLOCK_ROW_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, row_generate_.get_next_row(i / RUN_LEN, row));
+    if (i >= NULL_START && i < NULL_END) {
+      row.storage_datums_[col_idx].set_null();
+    } else {
+      row.storage_datums_[col_idx].set_uint(i / RUN_LEN);
+    }
+    ASSERT_EQ(OB_SUCCESS, encoder_.append_row(row)) << "i: " << i << std::endl;
+  }
+  char *buf = NULL;
+  int64_t size = 0;
+  ASSERT_EQ(OB_SUCCESS, encoder_.build_block(buf, size));
+  ObMicroBlockDecoder decoder;
+  ObMicroBlockData data(encoder_.get_data().data(), encoder_.get_data().pos());
+  ASSERT_EQ(OB_SUCCESS, decoder.init(data, read_info_));
+  ASSERT_EQ(ObColumnHeader::Type::RLE, decoder.decoders_[col_idx].ctx_->col_header_->type_);
+
+  const sql::ObWhiteFilterOperatorType op_types[] = {
+      sql::WHITE_OP_EQ, sql::WHITE_OP_NE, sql::WHITE_OP_LT, sql::WHITE_OP_GE,
+      sql::WHITE_OP_NU, sql::WHITE_OP_NN};
+  const uint64_t max_value = (BLOCK_ROW_CNT - 1) / RUN_LEN;
+  for (int64_t i = 0; i < ARRAYSIZEOF(op_types); ++i) {
+    for (uint64_t param = 0; param <= max_value + 1; ++param) {
+      sql::ObPushdownWhiteFilterNode white_filter(allocator_);
+      ObMalloc mallocer;
+      mallocer.set_label("RLEDecoder");
+      ObFixedArray<ObObj, ObIAllocator> objs(mallocer, 1);
+      ObObj ref_obj;
+      ref_obj.set_uint64(param);
+      ref_obj.set_collation_type(CS_TYPE_BINARY);
+      ref_obj.set_collation_level(CS_LEVEL_NUMERIC);
+      ASSERT_EQ(OB_SUCCESS, objs.init(1));
+      if (sql::WHITE_OP_NU != op_types[i] && sql::WHITE_OP_NN != op_types[i]) {
+        ASSERT_EQ(OB_SUCCESS, objs.push_back(ref_obj));
+      }
+      white_filter.op_type_ = op_types[i];
+      ObBitmap result_bitmap(allocator_);
+      ASSERT_EQ(OB_SUCCESS, result_bitmap.init(BLOCK_ROW_CNT));
+      ASSERT_EQ(OB_SUCCESS, test_filter_pushdown(col_idx, false, decoder, white_filter, result_bitmap, objs));
+      for (int64_t r = 0; r < BLOCK_ROW_CNT; ++r) {
+        const bool is_null = r >= NULL_START && r < NULL_END;
+        const uint64_t value = r / RUN_LEN;
+        bool expected = false;
+        switch (op_types[i]) {
+          case sql::WHITE_OP_EQ: expected = !is_null && value == param; break;
+          case sql::WHITE_OP_NE: expected = !is_null && value != param; break;
+          case sql::WHITE_OP_LT: expected = !is_null && value < param; break;
+          case sql::WHITE_OP_GE: expected = !is_null && value >= param; break;
+          case sql::WHITE_OP_NU: expected = is_null; break;
+          case sql::WHITE_OP_NN: expected = !is_null; break;
+          default: break;
+        }
+        ASSERT_EQ(expected, result_bitmap.test(r))
+            << "op: " << op_types[i] << " param: " << param << " row: " << r;
+      }
+    }
+  }
+}
+
+} // end namespace blocksstable
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_decoder_simd.log*");
+  OB_LOGGER.set_file_name("test_decoder_simd.log", true, false);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
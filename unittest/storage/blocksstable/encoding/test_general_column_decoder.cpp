@@ -21,7 +21,8 @@
             TEST_F(x, basic_filter_pushdown_op_test_eq_ne_nu_nn) { basic_filter_pushdown_eq_ne_nu_nn_test(); } \
             TEST_F(x, basic_filter_pushdown_op_test_comparison) { basic_filter_pushdown_comparison_test(); } \
             TEST_F(x, basic_filter_pushdown_op_test_in) { basic_filter_pushdown_in_op_test(); } \
-            TEST_F(x, basic_filter_pushdown_op_test_bt) { basic_filter_pushdown_bt_test(); }
+            TEST_F(x, basic_filter_pushdown_op_test_bt) { basic_filter_pushdown_bt_test(); } \
+            TEST_F(x, basic_filter_pushdown_op_test_like) { basic_filter_pushdown_like_test(); }
 
 namespace oceanbase
 {
@@ -81,6 +82,13 @@ public:
   virtual ~TestStringPrefixDecoder() {}
 };
 
+class TestRawColumnDecoder : public TestColumnDecoder
+{
+public:
+  TestRawColumnDecoder() : TestColumnDecoder(ObColumnHeader::Type::RAW) {}
+  virtual ~TestRawColumnDecoder() {}
+};
+
 TEST_F(TestIntBaseDiffDecoder, filter_pushdown_comaprison_neg_test)
 {
   filter_pushdown_comaprison_neg_test();
@@ -96,6 +104,16 @@ TEST_F(TestHexDecoder, basic_filter_pushdown_op_test_eq_ne_nu_nn)
   basic_filter_pushdown_eq_ne_nu_nn_test();
 }
 
+TEST_F(TestRawColumnDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
+TEST_F(TestStringPrefixDecoder, basic_filter_pushdown_op_test_like)
+{
+  basic_filter_pushdown_like_test();
+}
+
 TEST_F(TestDictDecoder, batch_decode_to_datum_condense_test)
 {
   batch_decode_to_datum_test(true);
@@ -0,0 +1,198 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "storage/blocksstable/ob_macro_block.h"
+#include "share/schema/ob_table_schema.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestIndexBlockAggregator : public ::testing::Test
+{
+public:
+  static const int64_t TABLE_ID = 3001;
+  static const int64_t ROWKEY_COLUMN_COUNT = 1;
+  // rowkey, trans version, sql sequence, int column, varchar column
+  static const int64_t STORE_COLUMN_COUNT = 5;
+public:
+  TestIndexBlockAggregator() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+  void prepare_row(const int64_t key, const bool int_is_null, const int64_t int_val, const char *str_val);
+protected:
+  ObTableSchema table_schema_;
+  ObDataStoreDesc data_desc_;
+  ObDatumRow row_;
+  ObArenaAllocator allocator_;
+};
+
+void TestIndexBlockAggregator::SetUp()
+{
+  oceanbase::ObClusterVersion::get_instance().update_data_version(DATA_CURRENT_VERSION);
+  ObColumnSchemaV2 column;
+  table_schema_.reset();
+  ASSERT_EQ(OB_SUCCESS, table_schema_.set_table_name("test_index_block_aggregator"));
+  table_schema_.set_tenant_id(1);
+  table_schema_.set_tablegroup_id(1);
+  table_schema_.set_database_id(1);
+  table_schema_.set_table_id(TABLE_ID);
+  table_schema_.set_rowkey_column_num(ROWKEY_COLUMN_COUNT);
+  table_schema_.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + 2);
+  const ObObjType col_types[] = {ObIntType, ObIntType, ObVarcharType};
+  char name[OB_MAX_FILE_NAME_LENGTH];
+  for (int64_t i = 0; i < 3; ++i) {
+    column.reset();
+    column.set_table_id(TABLE_ID);
+    column.set_column_id(i + OB_APP_MIN_COLUMN_ID);
+    sprintf(name, "test%020ld", i);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name));
+    column.set_data_type(col_types[i]);
+    column.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+    column.set_rowkey_position(0 == i ? 1 : 0);
+    ASSERT_EQ(OB_SUCCESS, table_schema_.add_column(column));
+  }
+  ASSERT_EQ(OB_SUCCESS, data_desc_.init(table_schema_, share::ObLSID(1), ObTabletID(1), MAJOR_MERGE, 1));
+  ASSERT_EQ(STORE_COLUMN_COUNT, data_desc_.row_column_count_);
+  ASSERT_EQ(OB_SUCCESS, row_.init(allocator_, STORE_COLUMN_COUNT));
+}
+
+void TestIndexBlockAggregator::prepare_row(
+    const int64_t key,
+    const bool int_is_null,
+    const int64_t int_val,
+    const char *str_val)
+{
+  row_.storage_datums_[0].set_int(key);
+  row_.storage_datums_[1].set_int(-1);
+  row_.storage_datums_[2].set_int(0);
+  if (int_is_null) {
+    row_.storage_datums_[3].set_null();
+  } else {
+    row_.storage_datums_[3].set_int(int_val);
+  }
+  if (nullptr == str_val) {
+    row_.storage_datums_[4].set_null();
+  } else {
+    row_.storage_datums_[4].set_string(str_val, static_cast<int32_t>(strlen(str_val)));
+  }
+}
+
+TEST_F(TestIndexBlockAggregator, test_aggregate)
+{
+  ObSkipIndexAggregator aggregator;
+  ObAggRowReader reader;
+  ObSkipIndexColAgg col_agg;
+  const char *agg_buf = nullptr;
+  int64_t agg_size = 0;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(data_desc_));
+
+  prepare_row(1, false, 10, "bbb");
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row_));
+  prepare_row(2, true, 0, "aaa");
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row_));
+  prepare_row(3, false, -5, "this value is longer than skip index limit");
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row_));
+  prepare_row(4, false, 7, nullptr);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row_));
+
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_row(agg_buf, agg_size));
+  ASSERT_TRUE(nullptr != agg_buf);
+  ASSERT_GT(agg_size, 0);
+  ASSERT_EQ(OB_SUCCESS, reader.init(agg_buf, agg_size));
+
+  // rowkey column
+  ASSERT_EQ(OB_SUCCESS, reader.get_col_agg(0, col_agg));
+  ASSERT_TRUE(col_agg.is_covered_);
+  ASSERT_TRUE(col_agg.has_min_max_);
+  ASSERT_EQ(0, col_agg.null_count_);
+  ASSERT_EQ(1, col_agg.min_.get_int());
+  ASSERT_EQ(4, col_agg.max_.get_int());
+
+  // multi-version column has null count only
+  ASSERT_EQ(OB_SUCCESS, reader.get_col_agg(1, col_agg));
+  ASSERT_TRUE(col_agg.is_covered_);
+  ASSERT_FALSE(col_agg.has_min_max_);
+
+  ASSERT_EQ(OB_SUCCESS, reader.get_col_agg(3, col_agg));
+  ASSERT_TRUE(col_agg.is_covered_);
+  ASSERT_TRUE(col_agg.has_min_max_);
+  ASSERT_EQ(1, col_agg.null_count_);
+  ASSERT_EQ(-5, col_agg.min_.get_int());
+  ASSERT_EQ(10, col_agg.max_.get_int());
+
+  // too long value invalidates min/max but keeps null count
+  ASSERT_EQ(OB_SUCCESS, reader.get_col_agg(4, col_agg));
+  ASSERT_TRUE(col_agg.is_covered_);
+  ASSERT_FALSE(col_agg.has_min_max_);
+  ASSERT_EQ(1, col_agg.null_count_);
+
+  // column out of skip index
+  ASSERT_EQ(OB_SUCCESS, reader.get_col_agg(STORE_COLUMN_COUNT, col_agg));
+  ASSERT_FALSE(col_agg.is_covered_);
+}
+
+TEST_F(TestIndexBlockAggregator, test_reuse)
+{
+  ObSkipIndexAggregator aggregator;
+  ObAggRowReader reader;
+  ObSkipIndexColAgg col_agg;
+  const char *agg_buf = nullptr;
+  int64_t agg_size = 0;
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(data_desc_));
+
+  prepare_row(1, false, 100, "zzz");
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row_));
+  aggregator.reuse();
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_row(agg_buf, agg_size));
+  ASSERT_TRUE(nullptr == agg_buf);
+
+  prepare_row(2, true, 0, "abc");
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row_));
+  prepare_row(3, true, 0, "abd");
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(row_));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_aggregated_row(agg_buf, agg_size));
+  ASSERT_EQ(OB_SUCCESS, reader.init(agg_buf, agg_size));
+
+  // all null column
+  ASSERT_EQ(OB_SUCCESS, reader.get_col_agg(3, col_agg));
+  ASSERT_TRUE(col_agg.is_covered_);
+  ASSERT_FALSE(col_agg.has_min_max_);
+  ASSERT_EQ(2, col_agg.null_count_);
+
+  ASSERT_EQ(OB_SUCCESS, reader.get_col_agg(4, col_agg));
+  ASSERT_TRUE(col_agg.has_min_max_);
+  ASSERT_EQ(0, col_agg.null_count_);
+  ASSERT_EQ(0, col_agg.min_.get_string().compare("abc"));
+  ASSERT_EQ(0, col_agg.max_.get_string().compare("abd"));
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_index_block_aggregator.log");
+  OB_LOGGER.set_file_name("test_index_block_aggregator.log", true, true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,637 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/blocksstable/ob_index_block_aggregator.h"
+#include "storage/blocksstable/ob_macro_block.h"
+#include "storage/access/ob_block_row_store.h"
+#include "storage/access/ob_table_access_context.h"
+#include "share/schema/ob_table_schema.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
+#include "sql/engine/expr/ob_expr_join_filter.h"
+#include "sql/engine/px/p2p_datahub/ob_runtime_filter_msg.h"
+#include "share/datum/ob_datum_funcs.h"
+#include "unittest/storage/mock_ob_table_read_info.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestSkipIndexFilter : public ::testing::Test
+{
+public:
+  static const int64_t TABLE_ID = 3001;
+  static const int64_t ROWKEY_COLUMN_COUNT = 1;
+  // rowkey, trans version, sql sequence, utf8mb4_bin varchar, binary varchar
+  static const int64_t STORE_COLUMN_COUNT = 5;
+  // output columns of the scan: rowkey, utf8mb4_bin varchar, binary varchar
+  static const int64_t STR_COL_OFFSET = 1;
+  static const int64_t BIN_COL_OFFSET = 2;
+public:
+  TestSkipIndexFilter() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp();
+  virtual void TearDown() {}
+  void build_agg_row(const char *values[], const int64_t count);
+  void check_like_skip(const int64_t col_offset,
+                       const char *pattern,
+                       const ObCollationType cs_type,
+                       bool &can_skip);
+  void init_topn_filter(const ObObjType type,
+                        const ObCollationType cs_type,
+                        const ObCmpNullPos null_pos,
+                        const bool is_ascending,
+                        sql::ObPushdownTopNFilter &filter);
+  void check_topn_skip(const sql::ObPushdownTopNFilter &filter,
+                       const int64_t col_offset,
+                       bool &can_skip);
+  void init_range_msg(const ObDatum &lower,
+                      const ObDatum &upper,
+                      sql::ObRFRangeFilterMsg &msg);
+  void init_in_msg(const ObStorageDatum *values,
+                   const int64_t count,
+                   sql::ObRFInFilterMsg &msg);
+  void check_runtime_filter_skip(sql::ObP2PDatahubMsgBase &msg,
+                                 const int64_t col_offset,
+                                 const ObObjType type,
+                                 bool &can_skip);
+protected:
+  ObTableSchema table_schema_;
+  ObDataStoreDesc data_desc_;
+  ObDatumRow row_;
+  ObSkipIndexAggregator aggregator_;
+  ObAggRowReader agg_row_reader_;
+  int64_t row_count_;
+  MockObTableReadInfo read_info_;
+  sql::ObExpr key_expr_;
+  ObArenaAllocator allocator_;
+};
+
+void TestSkipIndexFilter::SetUp()
+{
+  oceanbase::ObClusterVersion::get_instance().update_data_version(DATA_CURRENT_VERSION);
+  ObColumnSchemaV2 column;
+  table_schema_.reset();
+  ASSERT_EQ(OB_SUCCESS, table_schema_.set_table_name("test_skip_index_filter"));
+  table_schema_.set_tenant_id(1);
+  table_schema_.set_tablegroup_id(1);
+  table_schema_.set_database_id(1);
+  table_schema_.set_table_id(TABLE_ID);
+  table_schema_.set_rowkey_column_num(ROWKEY_COLUMN_COUNT);
+  table_schema_.set_max_used_column_id(OB_APP_MIN_COLUMN_ID + 2);
+  const ObObjType col_types[] = {ObIntType, ObVarcharType, ObVarcharType};
+  const ObCollationType cs_types[] = {CS_TYPE_UTF8MB4_BIN, CS_TYPE_UTF8MB4_BIN, CS_TYPE_BINARY};
+  char name[OB_MAX_FILE_NAME_LENGTH];
+  ObSEArray<ObColDesc, 3> cols_desc;
+  ObSEArray<int32_t, 3> storage_cols_index;
+  for (int64_t i = 0; i < 3; ++i) {
+    ObColDesc col_desc;
+    column.reset();
+    column.set_table_id(TABLE_ID);
+    column.set_column_id(i + OB_APP_MIN_COLUMN_ID);
+    sprintf(name, "test%020ld", i);
+    ASSERT_EQ(OB_SUCCESS, column.set_column_name(name));
+    column.set_data_type(col_types[i]);
+    column.set_collation_type(cs_types[i]);
+    column.set_rowkey_position(0 == i ? 1 : 0);
+    ASSERT_EQ(OB_SUCCESS, table_schema_.add_column(column));
+    col_desc.col_id_ = static_cast<uint32_t>(i + OB_APP_MIN_COLUMN_ID);
+    col_desc.col_type_.set_type(col_types[i]);
+    col_desc.col_type_.set_collation_type(cs_types[i]);
+    ASSERT_EQ(OB_SUCCESS, cols_desc.push_back(col_desc));
+    // skip the multi-version columns after rowkey
+    ASSERT_EQ(OB_SUCCESS, storage_cols_index.push_back(0 == i ? 0 : static_cast<int32_t>(i + 2)));
+  }
+  ASSERT_EQ(OB_SUCCESS, data_desc_.init(table_schema_, share::ObLSID(1), ObTabletID(1), MAJOR_MERGE, 1));
+  ASSERT_EQ(STORE_COLUMN_COUNT, data_desc_.row_column_count_);
+  ASSERT_EQ(OB_SUCCESS, row_.init(allocator_, STORE_COLUMN_COUNT));
+  ASSERT_EQ(OB_SUCCESS, aggregator_.init(data_desc_));
+  ASSERT_EQ(OB_SUCCESS, read_info_.init(allocator_, 3, ROWKEY_COLUMN_COUNT, false, cols_desc, &storage_cols_index));
+  row_count_ = 0;
+}
+
+void TestSkipIndexFilter::build_agg_row(const char *values[], const int64_t count)
+{
+  const char *agg_buf = nullptr;
+  int64_t agg_size = 0;
+  aggregator_.reuse();
+  agg_row_reader_.reset();
+  for (int64_t i = 0; i < count; ++i) {
+    row_.storage_datums_[0].set_int(i);
+    row_.storage_datums_[1].set_int(-1);
+    row_.storage_datums_[2].set_int(0);
+    row_.storage_datums_[3].set_string(values[i], static_cast<int32_t>(strlen(values[i])));
+    row_.storage_datums_[4].set_string(values[i], static_cast<int32_t>(strlen(values[i])));
+    ASSERT_EQ(OB_SUCCESS, aggregator_.eval(row_));
+  }
+  ASSERT_EQ(OB_SUCCESS, aggregator_.get_aggregated_row(agg_buf, agg_size));
+  ASSERT_EQ(OB_SUCCESS, agg_row_reader_.init(agg_buf, agg_size));
+  row_count_ = count;
+}
+
+void TestSkipIndexFilter::check_like_skip(
+    const int64_t col_offset,
+    const char *pattern,
+    const ObCollationType cs_type,
+    bool &can_skip)
+{
+  ObTableAccessContext context;
+  ObBlockRowStore row_store(context);
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator op(eval_ctx, expr_spec);
+  sql::ObPushdownWhiteFilterNode filter_node(allocator_);
+  filter_node.op_type_ = sql::WHITE_OP_LI;
+  sql::ObWhiteFilterExecutor filter(allocator_, filter_node, op);
+  const ObColumnParam *col_param = nullptr;
+  ObObj pattern_obj;
+  ObObj escape_obj;
+  pattern_obj.set_varchar(pattern);
+  pattern_obj.set_collation_type(cs_type);
+  escape_obj.set_null();
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.push_back(static_cast<int32_t>(col_offset)));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.push_back(col_param));
+  filter.n_cols_ = 1;
+  ASSERT_EQ(OB_SUCCESS, filter.params_.init(2));
+  ASSERT_EQ(OB_SUCCESS, filter.params_.push_back(pattern_obj));
+  ASSERT_EQ(OB_SUCCESS, filter.params_.push_back(escape_obj));
+  ASSERT_EQ(OB_SUCCESS, filter.init_like_pattern());
+  row_store.read_info_ = &read_info_;
+  ASSERT_EQ(OB_SUCCESS, row_store.check_white_filter_skip_index(agg_row_reader_, row_count_, filter, can_skip));
+}
+
+void TestSkipIndexFilter::init_topn_filter(
+    const ObObjType type,
+    const ObCollationType cs_type,
+    const ObCmpNullPos null_pos,
+    const bool is_ascending,
+    sql::ObPushdownTopNFilter &filter)
+{
+  ObDatumCmpFuncType cmp_func = ObDatumFuncs::get_nullsafe_cmp_func(
+      type, type, null_pos, cs_type, 0, false, false);
+  ASSERT_TRUE(nullptr != cmp_func);
+  ASSERT_EQ(OB_SUCCESS, filter.init(&key_expr_, cmp_func, is_ascending, allocator_));
+}
+
+void TestSkipIndexFilter::check_topn_skip(
+    const sql::ObPushdownTopNFilter &filter,
+    const int64_t col_offset,
+    bool &can_skip)
+{
+  ObTableAccessContext context;
+  ObBlockRowStore row_store(context);
+  row_store.read_info_ = &read_info_;
+  row_store.topn_filter_ = &filter;
+  row_store.topn_col_offset_ = static_cast<int32_t>(col_offset);
+  ASSERT_EQ(OB_SUCCESS, row_store.check_topn_skip_index(agg_row_reader_, can_skip));
+}
+
+void TestSkipIndexFilter::init_range_msg(
+    const ObDatum &lower,
+    const ObDatum &upper,
+    sql::ObRFRangeFilterMsg &msg)
+{
+  ASSERT_EQ(OB_SUCCESS, msg.lower_bounds_.init(1));
+  ASSERT_EQ(OB_SUCCESS, msg.upper_bounds_.init(1));
+  ASSERT_EQ(OB_SUCCESS, msg.lower_bounds_.push_back(lower));
+  ASSERT_EQ(OB_SUCCESS, msg.upper_bounds_.push_back(upper));
+  msg.is_empty_ = false;
+}
+
+void TestSkipIndexFilter::init_in_msg(
+    const ObStorageDatum *values,
+    const int64_t count,
+    sql::ObRFInFilterMsg &msg)
+{
+  for (int64_t i = 0; i < count; ++i) {
+    void *buf = allocator_.alloc(sizeof(ObFixedArray<ObDatum, ObIAllocator>));
+    ASSERT_TRUE(nullptr != buf);
+    ObFixedArray<ObDatum, ObIAllocator> *row = new (buf) ObFixedArray<ObDatum, ObIAllocator>(allocator_);
+    ASSERT_EQ(OB_SUCCESS, row->init(1));
+    ASSERT_EQ(OB_SUCCESS, row->push_back(values[i]));
+    ASSERT_EQ(OB_SUCCESS, msg.serial_rows_.push_back(row));
+  }
+  msg.col_cnt_ = 1;
+  msg.is_empty_ = 0 == count;
+}
+
+// evaluate a runtime filter on the column through the black filter skip index path
+void TestSkipIndexFilter::check_runtime_filter_skip(
+    sql::ObP2PDatahubMsgBase &msg,
+    const int64_t col_offset,
+    const ObObjType type,
+    bool &can_skip)
+{
+  ObTableAccessContext context;
+  ObBlockRowStore row_store(context);
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  sql::ObPushdownExprSpec expr_spec(allocator_);
+  sql::ObPushdownOperator op(eval_ctx, expr_spec);
+  sql::ObPushdownBlackFilterNode filter_node(allocator_);
+  sql::ObBlackFilterExecutor filter(allocator_, filter_node, op);
+  sql::ObExpr col_expr;
+  sql::ObExpr rf_expr;
+  sql::ObExpr *rf_args[] = {&col_expr};
+  const ObColumnParam *col_param = nullptr;
+  void *ctx_buf = nullptr;
+  ObCmpFunc cmp_func;
+  cmp_func.cmp_func_ = ObDatumFuncs::get_nullsafe_cmp_func(
+      type, type, NULL_FIRST, CS_TYPE_BINARY, 0, false, false);
+  rf_expr.type_ = T_OP_RUNTIME_FILTER;
+  rf_expr.arg_cnt_ = 1;
+  rf_expr.args_ = rf_args;
+  rf_expr.expr_ctx_id_ = 0;
+  ASSERT_EQ(OB_SUCCESS, filter_node.column_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter_node.filter_exprs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter_node.column_exprs_.push_back(&col_expr));
+  ASSERT_EQ(OB_SUCCESS, filter_node.filter_exprs_.push_back(&rf_expr));
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.init(1));
+  ASSERT_EQ(OB_SUCCESS, filter.col_offsets_.push_back(static_cast<int32_t>(col_offset)));
+  ASSERT_EQ(OB_SUCCESS, filter.col_params_.push_back(col_param));
+
+  // the msg is ready, as if it had been got from the p2p datahub
+  ASSERT_EQ(OB_SUCCESS, exec_ctx.init_expr_op(1));
+  ASSERT_EQ(OB_SUCCESS, exec_ctx.create_expr_op_ctx(0,
+      sizeof(sql::ObExprJoinFilter::ObExprJoinFilterContext), ctx_buf));
+  sql::ObExprJoinFilter::ObExprJoinFilterContext *rf_ctx =
+      new (ctx_buf) sql::ObExprJoinFilter::ObExprJoinFilterContext();
+  rf_ctx->cmp_funcs_.set_allocator(&allocator_);
+  ASSERT_EQ(OB_SUCCESS, rf_ctx->cmp_funcs_.init(1));
+  ASSERT_EQ(OB_SUCCESS, rf_ctx->cmp_funcs_.push_back(cmp_func));
+  msg.inc_ref_count();
+  rf_ctx->rf_msg_ = &msg;
+  rf_ctx->is_ready_ = true;
+
+  row_store.read_info_ = &read_info_;
+  ASSERT_EQ(OB_SUCCESS, row_store.check_black_filter_skip_index(agg_row_reader_, filter, can_skip));
+}
+
+TEST_F(TestSkipIndexFilter, test_like_prefix_below_space)
+{
+  bool can_skip = false;
+  // 'abc\n' < 'abc' with pad space, but 'abc\n' LIKE 'abc%'
+  const char *below_space[] = {"abb", "abc\n"};
+  build_agg_row(below_space, ARRAYSIZEOF(below_space));
+  check_like_skip(STR_COL_OFFSET, "abc%", CS_TYPE_UTF8MB4_BIN, can_skip);
+  ASSERT_FALSE(can_skip);
+  check_like_skip(BIN_COL_OFFSET, "abc%", CS_TYPE_BINARY, can_skip);
+  ASSERT_FALSE(can_skip);
+  check_like_skip(BIN_COL_OFFSET, "abc\n%", CS_TYPE_BINARY, can_skip);
+  ASSERT_FALSE(can_skip);
+
+  const char *tab_only[] = {"abc\t", "abc\t\t"};
+  build_agg_row(tab_only, ARRAYSIZEOF(tab_only));
+  check_like_skip(STR_COL_OFFSET, "abc%", CS_TYPE_UTF8MB4_BIN, can_skip);
+  ASSERT_FALSE(can_skip);
+  check_like_skip(BIN_COL_OFFSET, "abc%", CS_TYPE_BINARY, can_skip);
+  ASSERT_FALSE(can_skip);
+}
+
+TEST_F(TestSkipIndexFilter, test_like_prefix_binary)
+{
+  bool can_skip = false;
+  const char *values[] = {"abd", "abz", "abe"};
+  build_agg_row(values, ARRAYSIZEOF(values));
+  // prefix below min
+  check_like_skip(BIN_COL_OFFSET, "abc%", CS_TYPE_BINARY, can_skip);
+  ASSERT_TRUE(can_skip);
+  // prefix above max
+  check_like_skip(BIN_COL_OFFSET, "ac%", CS_TYPE_BINARY, can_skip);
+  ASSERT_TRUE(can_skip);
+  // max is a proper prefix of the like prefix
+  check_like_skip(BIN_COL_OFFSET, "abzz%", CS_TYPE_BINARY, can_skip);
+  ASSERT_TRUE(can_skip);
+  check_like_skip(BIN_COL_OFFSET, "abe%", CS_TYPE_BINARY, can_skip);
+  ASSERT_FALSE(can_skip);
+  check_like_skip(BIN_COL_OFFSET, "ab%", CS_TYPE_BINARY, can_skip);
+  ASSERT_FALSE(can_skip);
+  // pad space collation never prunes by like prefix
+  check_like_skip(STR_COL_OFFSET, "ac%", CS_TYPE_UTF8MB4_BIN, can_skip);
+  ASSERT_FALSE(can_skip);
+  // not a prefix pattern
+  check_like_skip(BIN_COL_OFFSET, "%c", CS_TYPE_BINARY, can_skip);
+  ASSERT_FALSE(can_skip);
+}
+
+TEST_F(TestSkipIndexFilter, test_topn_asc)
+{
+  sql::ObPushdownTopNFilter filter;
+  ObStorageDatum boundary;
+  ObStorageDatum min;
+  ObStorageDatum max;
+  bool can_skip = false;
+  init_topn_filter(ObIntType, CS_TYPE_BINARY, NULL_FIRST, true, filter);
+  min.set_int(11);
+  max.set_int(20);
+  // heap is not full yet
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_FALSE(can_skip);
+
+  boundary.set_int(10);
+  ASSERT_EQ(OB_SUCCESS, filter.update_boundary(boundary));
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_TRUE(can_skip);
+  // rows equal to the heap top are kept
+  min.set_int(10);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_FALSE(can_skip);
+  min.set_int(5);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_FALSE(can_skip);
+  // nulls first sort before any value
+  min.set_int(11);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, true, can_skip));
+  ASSERT_FALSE(can_skip);
+
+  sql::ObPushdownTopNFilter null_last_filter;
+  init_topn_filter(ObIntType, CS_TYPE_BINARY, NULL_LAST, true, null_last_filter);
+  ASSERT_EQ(OB_SUCCESS, null_last_filter.update_boundary(boundary));
+  ASSERT_EQ(OB_SUCCESS, null_last_filter.check_min_max(min, max, true, can_skip));
+  ASSERT_TRUE(can_skip);
+  // heap top is null with nulls last, every value sorts before it
+  boundary.set_null();
+  ASSERT_EQ(OB_SUCCESS, null_last_filter.update_boundary(boundary));
+  ASSERT_EQ(OB_SUCCESS, null_last_filter.check_min_max(min, max, true, can_skip));
+  ASSERT_FALSE(can_skip);
+}
+
+TEST_F(TestSkipIndexFilter, test_topn_desc)
+{
+  sql::ObPushdownTopNFilter filter;
+  ObStorageDatum boundary;
+  ObStorageDatum min;
+  ObStorageDatum max;
+  bool can_skip = false;
+  // null is the smallest value, desc order puts it last
+  init_topn_filter(ObIntType, CS_TYPE_BINARY, NULL_FIRST, false, filter);
+  boundary.set_int(10);
+  ASSERT_EQ(OB_SUCCESS, filter.update_boundary(boundary));
+  min.set_int(1);
+  max.set_int(9);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_TRUE(can_skip);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, true, can_skip));
+  ASSERT_TRUE(can_skip);
+  max.set_int(10);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_FALSE(can_skip);
+  max.set_int(15);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_FALSE(can_skip);
+
+  // null is the largest value, desc order puts it first
+  sql::ObPushdownTopNFilter null_last_filter;
+  init_topn_filter(ObIntType, CS_TYPE_BINARY, NULL_LAST, false, null_last_filter);
+  ASSERT_EQ(OB_SUCCESS, null_last_filter.update_boundary(boundary));
+  max.set_int(9);
+  ASSERT_EQ(OB_SUCCESS, null_last_filter.check_min_max(min, max, false, can_skip));
+  ASSERT_TRUE(can_skip);
+  ASSERT_EQ(OB_SUCCESS, null_last_filter.check_min_max(min, max, true, can_skip));
+  ASSERT_FALSE(can_skip);
+}
+
+TEST_F(TestSkipIndexFilter, test_topn_boundary_copy)
+{
+  sql::ObPushdownTopNFilter filter;
+  ObStorageDatum boundary;
+  ObStorageDatum min;
+  ObStorageDatum max;
+  bool can_skip = false;
+  char buf[32];
+  init_topn_filter(ObVarcharType, CS_TYPE_BINARY, NULL_FIRST, true, filter);
+  STRCPY(buf, "abc");
+  boundary.set_string(buf, 3);
+  ASSERT_EQ(OB_SUCCESS, filter.update_boundary(boundary));
+  // the heap top row may be overwritten after the boundary is published
+  STRCPY(buf, "zzz");
+  min.set_string("abd", 3);
+  max.set_string("abz", 3);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_TRUE(can_skip);
+  // a longer boundary reallocates the copy
+  boundary.set_string("abcdefghijklmnopqrstuvwxyz", 26);
+  ASSERT_EQ(OB_SUCCESS, filter.update_boundary(boundary));
+  min.set_string("abcdefghijklmnopqrstuvwxyz", 26);
+  ASSERT_EQ(OB_SUCCESS, filter.check_min_max(min, max, false, can_skip));
+  ASSERT_FALSE(can_skip);
+}
+
+TEST_F(TestSkipIndexFilter, test_topn_skip_index)
+{
+  sql::ObPushdownTopNFilter filter;
+  sql::ObPushdownTopNFilter str_filter;
+  ObStorageDatum boundary;
+  bool can_skip = false;
+  // rowkey of the block is [0, 2]
+  const char *values[] = {"abc", "abd", "abe"};
+  build_agg_row(values, ARRAYSIZEOF(values));
+  init_topn_filter(ObIntType, CS_TYPE_BINARY, NULL_FIRST, true, filter);
+  boundary.set_int(-1);
+  ASSERT_EQ(OB_SUCCESS, filter.update_boundary(boundary));
+  check_topn_skip(filter, 0, can_skip);
+  ASSERT_TRUE(can_skip);
+  boundary.set_int(0);
+  ASSERT_EQ(OB_SUCCESS, filter.update_boundary(boundary));
+  check_topn_skip(filter, 0, can_skip);
+  ASSERT_FALSE(can_skip);
+
+  init_topn_filter(ObVarcharType, CS_TYPE_BINARY, NULL_FIRST, true, str_filter);
+  boundary.set_string("abb", 3);
+  ASSERT_EQ(OB_SUCCESS, str_filter.update_boundary(boundary));
+  check_topn_skip(str_filter, BIN_COL_OFFSET, can_skip);
+  ASSERT_TRUE(can_skip);
+
+  // no min/max for too long value, the block is always read
+  const char *long_values[] = {"abc", "this value is longer than skip index limit"};
+  build_agg_row(long_values, ARRAYSIZEOF(long_values));
+  check_topn_skip(str_filter, BIN_COL_OFFSET, can_skip);
+  ASSERT_FALSE(can_skip);
+}
+
+TEST_F(TestSkipIndexFilter, test_runtime_range_filter)
+{
+  ObStorageDatum lower;
+  ObStorageDatum upper;
+  bool can_skip = false;
+  // rowkey of the block is [0, 2]
+  const char *values[] = {"abc", "abd", "abe"};
+  build_agg_row(values, ARRAYSIZEOF(values));
+  {
+    sql::ObRFRangeFilterMsg msg;
+    lower.set_int(3);
+    upper.set_int(5);
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_TRUE(can_skip);
+  }
+  {
+    sql::ObRFRangeFilterMsg msg;
+    lower.set_int(-5);
+    upper.set_int(-1);
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_TRUE(can_skip);
+  }
+  {
+    // bound equal to the max of the block
+    sql::ObRFRangeFilterMsg msg;
+    lower.set_int(2);
+    upper.set_int(5);
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    sql::ObRFRangeFilterMsg msg;
+    lower.set_int(-1);
+    upper.set_int(0);
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    sql::ObRFRangeFilterMsg msg;
+    lower.set_int(1);
+    upper.set_int(1);
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    // null bound may match null with null safe equal
+    sql::ObRFRangeFilterMsg msg;
+    lower.set_null();
+    upper.set_int(-1);
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    // build side is empty
+    sql::ObRFRangeFilterMsg msg;
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_TRUE(can_skip);
+  }
+}
+
+TEST_F(TestSkipIndexFilter, test_runtime_in_filter)
+{
+  ObStorageDatum in_values[2];
+  bool can_skip = false;
+  // rowkey of the block is [0, 2]
+  const char *values[] = {"abc", "abd", "abe"};
+  build_agg_row(values, ARRAYSIZEOF(values));
+  {
+    sql::ObRFInFilterMsg msg;
+    in_values[0].set_int(-1);
+    in_values[1].set_int(5);
+    init_in_msg(in_values, 2, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_TRUE(can_skip);
+  }
+  {
+    sql::ObRFInFilterMsg msg;
+    in_values[0].set_int(-1);
+    in_values[1].set_int(1);
+    init_in_msg(in_values, 2, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    // value equal to the max of the block
+    sql::ObRFInFilterMsg msg;
+    in_values[0].set_int(2);
+    init_in_msg(in_values, 1, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    // null value may match null with null safe equal
+    sql::ObRFInFilterMsg msg;
+    in_values[0].set_null();
+    in_values[1].set_int(5);
+    init_in_msg(in_values, 2, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    // too many build rows, the in filter is not used
+    sql::ObRFInFilterMsg msg;
+    in_values[0].set_int(5);
+    init_in_msg(in_values, 1, msg);
+    msg.is_active_ = false;
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    sql::ObRFInFilterMsg msg;
+    init_in_msg(in_values, 0, msg);
+    check_runtime_filter_skip(msg, 0, ObIntType, can_skip);
+    ASSERT_TRUE(can_skip);
+  }
+}
+
+TEST_F(TestSkipIndexFilter, test_runtime_filter_without_min_max)
+{
+  ObStorageDatum lower;
+  ObStorageDatum upper;
+  bool can_skip = false;
+  lower.set_string("zzz", 3);
+  upper.set_string("zzz", 3);
+  const char *values[] = {"abc", "abd"};
+  build_agg_row(values, ARRAYSIZEOF(values));
+  {
+    sql::ObRFRangeFilterMsg msg;
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, BIN_COL_OFFSET, ObVarcharType, can_skip);
+    ASSERT_TRUE(can_skip);
+  }
+  // no min/max for too long value, the block is always read
+  const char *long_values[] = {"abc", "this value is longer than skip index limit"};
+  build_agg_row(long_values, ARRAYSIZEOF(long_values));
+  {
+    sql::ObRFRangeFilterMsg msg;
+    init_range_msg(lower, upper, msg);
+    check_runtime_filter_skip(msg, BIN_COL_OFFSET, ObVarcharType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+  {
+    sql::ObRFInFilterMsg msg;
+    init_in_msg(&lower, 1, msg);
+    check_runtime_filter_skip(msg, BIN_COL_OFFSET, ObVarcharType, can_skip);
+    ASSERT_FALSE(can_skip);
+  }
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -rf test_skip_index_filter.log");
+  OB_LOGGER.set_file_name("test_skip_index_filter.log", true, true);
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/access/ob_aggregated_store.h"
+#include "share/schema/ob_table_param.h"
+#include "sql/engine/ob_exec_context.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+using namespace share::schema;
+
+namespace unittest
+{
+class TestSumAggCell : public ::testing::Test
+{
+public:
+  static const int64_t BATCH_SIZE = 16;
+  static const int64_t FRAME_SIZE = 4096;
+  TestSumAggCell()
+    : allocator_(ObModIds::TEST), exec_ctx_(allocator_), eval_ctx_(exec_ctx_),
+      col_param_(allocator_), cell_(nullptr)
+  {}
+  virtual void SetUp();
+  virtual void TearDown();
+protected:
+  void init_cell(const ObObjType col_type, const ObObjType res_type);
+  void check_null_result();
+  void check_number_result(const char *expected);
+  void check_double_result(const double expected);
+  void set_number(const char *str, ObDatum &datum);
+protected:
+  ObArenaAllocator allocator_;
+  sql::ObExecContext exec_ctx_;
+  sql::ObEvalCtx eval_ctx_;
+  ObColumnParam col_param_;
+  sql::ObExpr expr_;
+  ObSumAggCell *cell_;
+};
+
+void TestSumAggCell::SetUp()
+{
+  eval_ctx_.frames_ = static_cast<char **>(allocator_.alloc(sizeof(char *)));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_);
+  eval_ctx_.frames_[0] = static_cast<char *>(allocator_.alloc(FRAME_SIZE));
+  ASSERT_TRUE(nullptr != eval_ctx_.frames_[0]);
+  MEMSET(eval_ctx_.frames_[0], 0, FRAME_SIZE);
+  // datum, eval info and result buffer of the sum expr in frame 0
+  expr_.frame_idx_ = 0;
+  expr_.datum_off_ = 0;
+  expr_.eval_info_off_ = sizeof(ObDatum);
+  expr_.res_buf_off_ = 64;
+  expr_.res_buf_len_ = 512;
+}
+
+void TestSumAggCell::TearDown()
+{
+  if (nullptr != cell_) {
+    cell_->~ObSumAggCell();
+    cell_ = nullptr;
+  }
+}
+
+void TestSumAggCell::init_cell(const ObObjType col_type, const ObObjType res_type)
+{
+  ObObjMeta meta;
+  meta.set_type(col_type);
+  col_param_.set_meta_type(meta);
+  expr_.type_ = T_FUN_SUM;
+  expr_.datum_meta_.type_ = res_type;
+  void *buf = allocator_.alloc(sizeof(ObSumAggCell));
+  ASSERT_TRUE(nullptr != buf);
+  cell_ = new (buf) ObSumAggCell(0, &col_param_, &expr_, allocator_);
+  ASSERT_EQ(OB_SUCCESS, cell_->init(BATCH_SIZE));
+}
+
+void TestSumAggCell::check_null_result()
+{
+  ASSERT_EQ(OB_SUCCESS, cell_->fill_result(eval_ctx_, false));
+  ASSERT_TRUE(expr_.locate_expr_datum(eval_ctx_).is_null());
+}
+
+void TestSumAggCell::check_number_result(const char *expected)
+{
+  number::ObNumber expected_nmb;
+  ASSERT_EQ(OB_SUCCESS, expected_nmb.from(expected, allocator_));
+  ASSERT_EQ(OB_SUCCESS, cell_->fill_result(eval_ctx_, false));
+  const ObDatum &result = expr_.locate_expr_datum(eval_ctx_);
+  ASSERT_FALSE(result.is_null());
+  const number::ObNumber result_nmb(result.get_number());
+  ASSERT_TRUE(result_nmb.is_equal(expected_nmb)) << "result: " << result_nmb.format()
+                                                 << " expected: " << expected;
+}
+
+void TestSumAggCell::check_double_result(const double expected)
+{
+  ASSERT_EQ(OB_SUCCESS, cell_->fill_result(eval_ctx_, false));
+  const ObDatum &result = expr_.locate_expr_datum(eval_ctx_);
+  ASSERT_FALSE(result.is_null());
+  ASSERT_EQ(expected, result.get_double());
+}
+
+void TestSumAggCell::set_number(const char *str, ObDatum &datum)
+{
+  number::ObNumber nmb;
+  ASSERT_EQ(OB_SUCCESS, nmb.from(str, allocator_));
+  char *buf = static_cast<char *>(allocator_.alloc(number::ObNumber::MAX_CALC_BYTE_LEN));
+  ASSERT_TRUE(nullptr != buf);
+  datum.ptr_ = buf;
+  datum.set_number(nmb);
+}
+
+TEST_F(TestSumAggCell, null_only)
+{
+  ObDatum datums[BATCH_SIZE];
+  for (int64_t i = 0; i < BATCH_SIZE; ++i) {
+    datums[i].set_null();
+  }
+  init_cell(ObIntType, ObNumberType);
+  // sum of an empty set is null
+  check_null_result();
+  ASSERT_EQ(OB_SUCCESS, cell_->eval(datums[0]));
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, BATCH_SIZE));
+  check_null_result();
+  TearDown();
+
+  init_cell(ObDoubleType, ObDoubleType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, BATCH_SIZE));
+  check_null_result();
+  TearDown();
+
+  init_cell(ObNumberType, ObNumberType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, BATCH_SIZE));
+  check_null_result();
+}
+
+TEST_F(TestSumAggCell, mixed_null)
+{
+  ObDatum datums[5];
+  int64_t int_buf[5];
+  for (int64_t i = 0; i < 5; ++i) {
+    datums[i].ptr_ = reinterpret_cast<char *>(int_buf + i);
+  }
+  datums[0].set_int(1);
+  datums[1].set_null();
+  datums[2].set_int(2);
+  datums[3].set_null();
+  datums[4].set_int(-5);
+  init_cell(ObIntType, ObNumberType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, 5));
+  check_number_result("-2");
+  // reuse for the next scan
+  cell_->reuse();
+  check_null_result();
+  ASSERT_EQ(OB_SUCCESS, cell_->eval(datums[2]));
+  check_number_result("2");
+  TearDown();
+
+  datums[0].set_double(1.5);
+  datums[2].set_double(2.25);
+  datums[4].set_double(-0.5);
+  init_cell(ObDoubleType, ObDoubleType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, 5));
+  check_double_result(3.25);
+  TearDown();
+
+  set_number("1.5", datums[0]);
+  set_number("123456789012345678901234567890", datums[2]);
+  set_number("-0.25", datums[4]);
+  init_cell(ObNumberType, ObNumberType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, 5));
+  check_number_result("123456789012345678901234567891.25");
+}
+
+TEST_F(TestSumAggCell, int_overflow)
+{
+  ObDatum datums[4];
+  int64_t int_buf[4];
+  for (int64_t i = 0; i < 4; ++i) {
+    datums[i].ptr_ = reinterpret_cast<char *>(int_buf + i);
+  }
+  datums[0].set_int(INT64_MAX);
+  datums[1].set_int(INT64_MAX);
+  datums[2].set_int(1);
+  datums[3].set_int(-5);
+  init_cell(ObIntType, ObNumberType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, 4));
+  check_number_result("18446744073709551610");
+  TearDown();
+
+  datums[0].set_int(INT64_MIN);
+  datums[1].set_int(-1);
+  datums[2].set_int(INT64_MIN);
+  init_cell(ObIntType, ObNumberType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, 3));
+  check_number_result("-18446744073709551617");
+  TearDown();
+
+  datums[0].set_uint(UINT64_MAX);
+  datums[1].set_uint(2);
+  datums[2].set_uint(UINT64_MAX);
+  init_cell(ObUInt64Type, ObNumberType);
+  ASSERT_EQ(OB_SUCCESS, cell_->eval_batch(datums, 3));
+  check_number_result("36893488147419103231");
+}
+
+}//end namespace unittest
+}//end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_sum_agg_cell.log*");
+  OB_LOGGER.set_file_name("test_sum_agg_cell.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}